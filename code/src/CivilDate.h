@@ -0,0 +1,208 @@
+#ifndef CIVIL_DATE_H
+#define CIVIL_DATE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "Enums.h"
+
+/**
+ * @class CivilDate
+ * @brief Proleptic Gregorian calendar date stored as a signed 32-bit day number.
+ *
+ * The day number counts days since 01-01-1970, so comparisons and differences are
+ * plain integer operations and no record carries a formatted string. Conversion to
+ * and from year/month/day uses Howard Hinnant's days_from_civil/civil_from_days
+ * algorithms and is constexpr. Text ("DD-MM-YYYY") is only produced or consumed by
+ * toChars()/toString() and parse(). A default-constructed date is "none" and
+ * formats as "-" (e.g. a date of leaving that does not apply).
+ */
+class CivilDate {
+public:
+    enum CivilDateConstants {
+        FormattedLength = TotalDateFormatLength
+    };
+
+    constexpr CivilDate() : mDays(NoneValue) {}
+
+    /**
+     * @brief Builds a date from calendar fields. The fields are not validated; see isValidCivil().
+     */
+    static constexpr CivilDate fromCivil(int yearParm, int monthParm, int dayParm)
+    {
+        CivilDate sDate;
+        sDate.mDays = pDaysFromCivil(yearParm, monthParm, dayParm);
+        return sDate;
+    }
+
+    static constexpr CivilDate fromDayNumber(int32_t daysParm)
+    {
+        CivilDate sDate;
+        sDate.mDays = daysParm;
+        return sDate;
+    }
+
+    constexpr bool isNone() const { return mDays == NoneValue; }
+    constexpr int32_t dayNumber() const { return mDays; }
+
+    constexpr int year() const { return pToCivil().mYear; }
+    constexpr int month() const { return pToCivil().mMonth; }
+    constexpr int day() const { return pToCivil().mDay; }
+
+    static constexpr bool isLeapYear(int yearParm)
+    {
+        return (yearParm % 4 == 0) && ((yearParm % 100 != 0) || (yearParm % 400 == 0));
+    }
+
+    static constexpr int daysInMonth(int yearParm, int monthParm)
+    {
+        return monthParm == 2 ? (isLeapYear(yearParm) ? 29 : 28)
+                              : ((monthParm == 4 || monthParm == 6 || monthParm == 9 || monthParm == 11) ? 30 : 31);
+    }
+
+    static constexpr bool isValidCivil(int yearParm, int monthParm, int dayParm)
+    {
+        return monthParm >= 1 && monthParm <= 12 &&
+               dayParm >= 1 && dayParm <= daysInMonth(yearParm, monthParm);
+    }
+
+    /**
+     * @brief Adds (or subtracts) whole months; the day is clamped to the target month's length.
+     */
+    constexpr CivilDate addMonths(int monthsParm) const
+    {
+        Civil sCivil = pToCivil();
+        int sTotal = sCivil.mYear * 12 + (sCivil.mMonth - 1) + monthsParm;
+        int sYear = pFloorDiv(sTotal, 12);
+        int sMonth = sTotal - sYear * 12 + 1;
+        int sLast = daysInMonth(sYear, sMonth);
+        return fromCivil(sYear, sMonth, sCivil.mDay > sLast ? sLast : sCivil.mDay);
+    }
+
+    constexpr CivilDate addYears(int yearsParm) const { return addMonths(yearsParm * 12); }
+    constexpr CivilDate addDays(int daysParm) const { return fromDayNumber(mDays + daysParm); }
+
+    /**
+     * @brief Formats as DD-MM-YYYY (or "-" for none) into [firstParm, lastParm) without allocating.
+     * @return Pointer one past the last written character, or nullptr if the buffer is too small.
+     */
+    char* toChars(char* firstParm, char* lastParm) const
+    {
+        if (isNone())
+        {
+            if (lastParm - firstParm < 1) return nullptr;
+            *firstParm = '-';
+            return firstParm + 1;
+        }
+        if (lastParm - firstParm < FormattedLength) return nullptr;
+        Civil sCivil = pToCivil();
+        char* sOut = firstParm;
+        *sOut++ = static_cast<char>('0' + sCivil.mDay / 10);
+        *sOut++ = static_cast<char>('0' + sCivil.mDay % 10);
+        *sOut++ = '-';
+        *sOut++ = static_cast<char>('0' + sCivil.mMonth / 10);
+        *sOut++ = static_cast<char>('0' + sCivil.mMonth % 10);
+        *sOut++ = '-';
+        int sYear = sCivil.mYear;
+        for (int sI = DateYearLength - 1; sI >= 0; --sI)
+        {
+            sOut[sI] = static_cast<char>('0' + sYear % 10);
+            sYear /= 10;
+        }
+        return sOut + DateYearLength;
+    }
+
+    std::string toString() const
+    {
+        char sBuffer[FormattedLength];
+        return std::string(sBuffer, toChars(sBuffer, sBuffer + sizeof(sBuffer)));
+    }
+
+    /**
+     * @brief Parses a DD-MM-YYYY date with a year in [MinValidYear, MaxValidYear].
+     * @return false if the text is malformed or not a real calendar date.
+     */
+    static constexpr bool parse(std::string_view textParm, CivilDate& dateOutParm)
+    {
+        if (textParm.size() != static_cast<size_t>(FormattedLength)) return false;
+        if (textParm[2] != '-' || textParm[5] != '-') return false;
+        int sDay = 0, sMonth = 0, sYear = 0;
+        if (!pReadDigits(textParm, 0, DateDayLength, sDay) ||
+            !pReadDigits(textParm, 3, DateMonthLength, sMonth) ||
+            !pReadDigits(textParm, 6, DateYearLength, sYear)) return false;
+        if (sYear < MinValidYear || sYear > MaxValidYear) return false;
+        if (!isValidCivil(sYear, sMonth, sDay)) return false;
+        dateOutParm = fromCivil(sYear, sMonth, sDay);
+        return true;
+    }
+
+    constexpr bool operator==(const CivilDate& otherParm) const { return mDays == otherParm.mDays; }
+    constexpr bool operator!=(const CivilDate& otherParm) const { return mDays != otherParm.mDays; }
+    constexpr bool operator<(const CivilDate& otherParm) const { return mDays < otherParm.mDays; }
+    constexpr bool operator>(const CivilDate& otherParm) const { return mDays > otherParm.mDays; }
+    constexpr bool operator<=(const CivilDate& otherParm) const { return mDays <= otherParm.mDays; }
+    constexpr bool operator>=(const CivilDate& otherParm) const { return mDays >= otherParm.mDays; }
+
+    /**
+     * @brief Signed number of days from otherParm to this date.
+     */
+    constexpr int32_t operator-(const CivilDate& otherParm) const { return mDays - otherParm.mDays; }
+
+private:
+    static constexpr int32_t NoneValue = INT32_MIN;
+
+    struct Civil {
+        int mYear;
+        int mMonth;
+        int mDay;
+    };
+
+    static constexpr int pFloorDiv(int valueParm, int divisorParm)
+    {
+        return (valueParm >= 0 ? valueParm : valueParm - divisorParm + 1) / divisorParm;
+    }
+
+    // Days since 01-01-1970; the year is shifted to start in March so the leap day is last.
+    static constexpr int32_t pDaysFromCivil(int yearParm, int monthParm, int dayParm)
+    {
+        int sYear = yearParm - (monthParm <= 2 ? 1 : 0);
+        int sEra = pFloorDiv(sYear, 400);
+        int sYoe = sYear - sEra * 400;                                                    // [0, 399]
+        int sDoy = (153 * (monthParm + (monthParm > 2 ? -3 : 9)) + 2) / 5 + dayParm - 1;  // [0, 365]
+        int sDoe = sYoe * 365 + sYoe / 4 - sYoe / 100 + sDoy;                             // [0, 146096]
+        return sEra * 146097 + sDoe - 719468;
+    }
+
+    constexpr Civil pToCivil() const
+    {
+        int sZ = mDays + 719468;
+        int sEra = pFloorDiv(sZ, 146097);
+        int sDoe = sZ - sEra * 146097;                                          // [0, 146096]
+        int sYoe = (sDoe - sDoe / 1460 + sDoe / 36524 - sDoe / 146096) / 365;   // [0, 399]
+        int sDoy = sDoe - (365 * sYoe + sYoe / 4 - sYoe / 100);                 // [0, 365]
+        int sMp = (5 * sDoy + 2) / 153;                                         // [0, 11]
+        Civil sCivil{0, 0, 0};
+        sCivil.mDay = sDoy - (153 * sMp + 2) / 5 + 1;
+        sCivil.mMonth = sMp < 10 ? sMp + 3 : sMp - 9;
+        sCivil.mYear = sYoe + sEra * 400 + (sCivil.mMonth <= 2 ? 1 : 0);
+        return sCivil;
+    }
+
+    static constexpr bool pReadDigits(std::string_view textParm, size_t posParm, int countParm, int& valueOutParm)
+    {
+        int sValue = 0;
+        for (int sI = 0; sI < countParm; ++sI)
+        {
+            unsigned sDigit = static_cast<unsigned>(textParm[posParm + sI] - '0');
+            if (sDigit > 9) return false;
+            sValue = sValue * 10 + static_cast<int>(sDigit);
+        }
+        valueOutParm = sValue;
+        return true;
+    }
+
+    int32_t mDays;
+};
+
+#endif // CIVIL_DATE_H
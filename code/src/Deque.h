@@ -2,57 +2,174 @@
 #define DEQUE_H
 
 #include <stdexcept>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
+#include "DequeBlockPool.h"
 
-// Node structure for deque
-template <typename T>
-struct Node
+// Deque class definition
+//
+// Segmented deque: elements live in fixed-size blocks that are reached through
+// a ring-shaped block map. Indexed access is O(1), push/pop at either end are
+// amortized O(1) and elements are contiguous within a block.
+//
+// Blocks come from the Allocator (allocateBlock/deallocateBlock/releaseAll/
+// systemAllocations); the default DequeBlockPool carves them out of slabs.
+template <typename T, typename Allocator = DequeBlockPool<T> >
+class Deque
 {
-    T mData;
-    Node *mPrevious;
-    Node *mNext;
+private:
+    enum DequeConstants {
+        BlockBytes = 512,
+        MinBlockCapacity = 16,
+        InitialMapCapacity = 8
+    };
 
-    Node(const T &valueParm) : mData(valueParm), mPrevious(nullptr), mNext(nullptr)
+    // Elements per block, rounded to a power of two so that index math is shifts/masks.
+    static constexpr size_t pComputeBlockCapacity()
     {
+        size_t sWanted = (sizeof(T) < BlockBytes / MinBlockCapacity) ? BlockBytes / sizeof(T) : MinBlockCapacity;
+        size_t sCapacity = 1;
+        while (sCapacity < sWanted)
+        {
+            sCapacity <<= 1;
+        }
+        return sCapacity;
     }
-};
+    static constexpr size_t BlockCapacity = pComputeBlockCapacity();
 
-// Deque class definition
-template <typename T>
-class Deque
-{
-private:
+    T** mMap;             // ring of block pointers, nullptr for slots without a block
+    size_t mMapCapacity;  // always zero or a power of two
+    size_t mHeadBlock;    // physical map slot holding the first element
+    size_t mHeadOffset;   // offset of the first element within its block
     size_t mSize;
-    Node<T>* mHead;
-    Node<T>* mTail;
+    size_t mMapAllocations;
+    Allocator mAllocator;
 
-    // Private helper to get a node at a specific index
-    Node<T>* pGetNodeAt(size_t indexParm) const;
+    // Private helpers for block/map bookkeeping
+    size_t pPhysicalSlot(size_t logicalBlockParm) const;
+    size_t pUsedBlocks() const;
+    T* pAllocateBlock();
+    void pFreeBlock(T* blockParm);
+    void pGrowMap();
+    T* pElementAddress(size_t indexParm) const;
 
 public:
+    /*Class name: IteratorBase
+      Purpose: Random-access (and therefore bidirectional) iterator over a Deque. It holds
+               the owning deque and a logical index, so dereferencing is O(1) and the
+               position stays meaningful across push/pop at the opposite end.
+    */
+    template <bool IsConst>
+    class IteratorBase
+    {
+    private:
+        typedef typename std::conditional<IsConst, const Deque*, Deque*>::type DequePtr;
+        DequePtr mDeque;
+        size_t mIndex;
+
+        friend class Deque;
+        template <bool> friend class IteratorBase;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+        typedef typename std::conditional<IsConst, const T&, T&>::type reference;
+
+        IteratorBase() : mDeque(nullptr), mIndex(0) {}
+        IteratorBase(DequePtr dequeParm, size_t indexParm) : mDeque(dequeParm), mIndex(indexParm) {}
+
+        // Allows iterator -> const_iterator conversion.
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        IteratorBase(const IteratorBase<OtherConst>& otherParm) : mDeque(otherParm.mDeque), mIndex(otherParm.mIndex) {}
+
+        reference operator*() const { return *mDeque->pElementAddress(mIndex); }
+        pointer operator->() const { return mDeque->pElementAddress(mIndex); }
+        reference operator[](difference_type offsetParm) const { return *mDeque->pElementAddress(mIndex + offsetParm); }
+
+        IteratorBase& operator++() { ++mIndex; return *this; }
+        IteratorBase operator++(int) { IteratorBase sCopy(*this); ++mIndex; return sCopy; }
+        IteratorBase& operator--() { --mIndex; return *this; }
+        IteratorBase operator--(int) { IteratorBase sCopy(*this); --mIndex; return sCopy; }
+
+        IteratorBase& operator+=(difference_type offsetParm) { mIndex += offsetParm; return *this; }
+        IteratorBase& operator-=(difference_type offsetParm) { mIndex -= offsetParm; return *this; }
+        IteratorBase operator+(difference_type offsetParm) const { return IteratorBase(mDeque, mIndex + offsetParm); }
+        IteratorBase operator-(difference_type offsetParm) const { return IteratorBase(mDeque, mIndex - offsetParm); }
+        friend IteratorBase operator+(difference_type offsetParm, const IteratorBase& itParm) { return itParm + offsetParm; }
+        difference_type operator-(const IteratorBase& otherParm) const
+        {
+            return static_cast<difference_type>(mIndex) - static_cast<difference_type>(otherParm.mIndex);
+        }
+
+        bool operator==(const IteratorBase& otherParm) const { return mIndex == otherParm.mIndex && mDeque == otherParm.mDeque; }
+        bool operator!=(const IteratorBase& otherParm) const { return !(*this == otherParm); }
+        bool operator<(const IteratorBase& otherParm) const { return mIndex < otherParm.mIndex; }
+        bool operator>(const IteratorBase& otherParm) const { return mIndex > otherParm.mIndex; }
+        bool operator<=(const IteratorBase& otherParm) const { return mIndex <= otherParm.mIndex; }
+        bool operator>=(const IteratorBase& otherParm) const { return mIndex >= otherParm.mIndex; }
+
+        /*Function name: index
+          Input Parameters: None
+          Output: Logical position of the iterator within its deque
+          Purpose: Lets callers hand an already-located position back to index-based APIs.
+        */
+        size_t index() const { return mIndex; }
+    };
+
+    typedef IteratorBase<false> iterator;
+    typedef IteratorBase<true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
     Deque();
     Deque(size_t sizeParm, const T &valueParm);
     Deque(const Deque&) = delete;
     Deque& operator=(const Deque&) = delete;
-    Deque(Deque&&) = delete;
-    Deque& operator=(Deque&&) = delete;
+    Deque(Deque&& otherParm) noexcept;
+    Deque& operator=(Deque&& otherParm) noexcept;
     ~Deque();
 
+    /*Function name: swap
+      Input Parameters: otherParm (deque to exchange contents with)
+      Output: None
+      Purpose: Exchanges block maps and allocators in O(1); no element is touched.
+    */
+    void swap(Deque& otherParm) noexcept;
+
     void push_back(const T &dataParm);
+    void push_back(T &&dataParm);
     void pop_back();
     void push_front(const T &dataParm);
+    void push_front(T &&dataParm);
     void pop_front();
-    
+
+    /*Function name: emplace_back / emplace_front
+      Input Parameters: argsParm (constructor arguments for T)
+      Output: Reference to the new element
+      Purpose: Constructs the element directly in its block slot.
+    */
+    template <typename... Args>
+    T& emplace_back(Args&&... argsParm);
+    template <typename... Args>
+    T& emplace_front(Args&&... argsParm);
+
     /*Function name: addAt
       Input Parameters: indexParm (position to add), dataParm (data to add)
       Output: None
-      Purpose: Adds an element at a specific index in the middle of the DLL (EDLL).
+      Purpose: Adds an element at a specific index, shifting the shorter side of the deque.
     */
-    void addAt(size_t indexParm, const T &dataParm); 
-    
+    void addAt(size_t indexParm, const T &dataParm);
+
     /*Function name: removeFrom
       Input Parameters: indexParm (position to remove)
       Output: None
-      Purpose: Removes an element from a specific index in the middle of the DLL (EDLL).
+      Purpose: Removes an element from a specific index, shifting the shorter side of the deque.
     */
     void removeFrom(size_t indexParm);
 
@@ -60,15 +177,15 @@ public:
     const T &back() const;
     bool empty() const;
     size_t size() const;
-    
+
     enum ResizeDirection {
         Forward,
         Reverse
     };
     void resize(size_t newSizeParm, const T &defaultValueParm, ResizeDirection directionParm);
-    
+
     void clear();
-    
+
     /*Function name: operator[]
       Input Parameters: indexParm (position of the element to access)
       Output: Const reference to the element at the specified index
@@ -81,19 +198,74 @@ public:
       Output: Non-const reference to the element at the specified index
       Purpose: Provides read/write access to the element at 'index' in the deque (REQUIRED for EDLL modification).
     */
-    T& operator[](size_t indexParm); 
+    T& operator[](size_t indexParm);
+
+    // Iteration
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, mSize); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, mSize); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*Function name: insert
+      Input Parameters: positionParm (iterator to insert before), dataParm (data to add)
+      Output: Iterator to the inserted element
+      Purpose: Inserts at an already-located position without re-locating it; only the
+               shorter side of the deque is shifted (O(1) at either end).
+    */
+    iterator insert(const_iterator positionParm, const T &dataParm);
+
+    /*Function name: erase
+      Input Parameters: positionParm (iterator to the element to remove)
+      Output: Iterator to the element that followed the removed one
+      Purpose: Removes an already-located element; only the shorter side is shifted.
+    */
+    iterator erase(const_iterator positionParm);
+
+    /*Function name: erase
+      Input Parameters: firstParm, lastParm (half-open range to remove)
+      Output: Iterator to the element that followed the removed range
+      Purpose: Removes a range by shifting the shorter side once, not once per element.
+    */
+    iterator erase(const_iterator firstParm, const_iterator lastParm);
+
+    /*Function name: splice
+      Input Parameters: positionParm (insert before, in this deque), otherParm (source deque),
+                        itParm or firstParm/lastParm (element or range taken from otherParm)
+      Output: None
+      Purpose: Moves elements out of another deque without copying them or allocating
+               per element. Blocks in a segmented deque cannot be relinked one element at
+               a time, so the elements are moved (not copied) and only the shorter side
+               of each deque is shifted; splicing at either end costs O(count).
+    */
+    void splice(const_iterator positionParm, Deque& otherParm, const_iterator itParm);
+    void splice(const_iterator positionParm, Deque& otherParm,
+                const_iterator firstParm, const_iterator lastParm);
+
+    /*Function name: systemAllocations
+      Input Parameters: None
+      Output: Number of global-allocator calls made for blocks and the block map
+      Purpose: Lets callers confirm that bulk loads allocate per slab, not per element.
+    */
+    size_t systemAllocations() const { return mAllocator.systemAllocations() + mMapAllocations; }
 
 };
 
 // --- Deque Implementation ---
 
-template <typename T>
-Deque<T>::Deque() : mSize(0), mHead(nullptr), mTail(nullptr)
+template <typename T, typename Allocator>
+Deque<T, Allocator>::Deque() : mMap(nullptr), mMapCapacity(0), mHeadBlock(0), mHeadOffset(0), mSize(0), mMapAllocations(0)
 {
 }
 
-template <typename T>
-Deque<T>::Deque(size_t sizeParm, const T &valueParm) : mSize(0), mHead(nullptr), mTail(nullptr)
+template <typename T, typename Allocator>
+Deque<T, Allocator>::Deque(size_t sizeParm, const T &valueParm)
+    : mMap(nullptr), mMapCapacity(0), mHeadBlock(0), mHeadOffset(0), mSize(0), mMapAllocations(0)
 {
     for (size_t sI = 0; sI < sizeParm; ++sI)
     {
@@ -101,208 +273,382 @@ Deque<T>::Deque(size_t sizeParm, const T &valueParm) : mSize(0), mHead(nullptr),
     }
 }
 
-template <typename T>
-Deque<T>::~Deque()
+template <typename T, typename Allocator>
+Deque<T, Allocator>::Deque(Deque&& otherParm) noexcept
+    : mMap(nullptr), mMapCapacity(0), mHeadBlock(0), mHeadOffset(0), mSize(0), mMapAllocations(0)
 {
-    clear();
+    swap(otherParm);
 }
 
-template <typename T>
-Node<T>* Deque<T>::pGetNodeAt(size_t indexParm) const
+template <typename T, typename Allocator>
+Deque<T, Allocator>& Deque<T, Allocator>::operator=(Deque&& otherParm) noexcept
 {
-    if (indexParm >= mSize)
+    if (this != &otherParm)
     {
-        return nullptr;
+        clear();
+        swap(otherParm);
     }
-    
-    Node<T>* sCurrent;
-    // Optimization: start from head or tail based on index
-    if (indexParm < mSize / 2)
-    {
-        sCurrent = mHead;
-        for (size_t sI = 0; sI < indexParm; ++sI)
-        {
-            sCurrent = sCurrent->mNext;
-        }
-    }
-    else
+    return *this;
+}
+
+template <typename T, typename Allocator>
+Deque<T, Allocator>::~Deque()
+{
+    clear();
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::swap(Deque& otherParm) noexcept
+{
+    std::swap(mMap, otherParm.mMap);
+    std::swap(mMapCapacity, otherParm.mMapCapacity);
+    std::swap(mHeadBlock, otherParm.mHeadBlock);
+    std::swap(mHeadOffset, otherParm.mHeadOffset);
+    std::swap(mSize, otherParm.mSize);
+    std::swap(mMapAllocations, otherParm.mMapAllocations);
+    mAllocator.swap(otherParm.mAllocator);
+}
+
+/*Function name: pPhysicalSlot
+  Input Parameters: logicalBlockParm (block number counted from the head block)
+  Output: Index of the map slot that holds the block
+  Purpose: Translates a logical block number into a slot of the ring-shaped map.
+*/
+template <typename T, typename Allocator>
+size_t Deque<T, Allocator>::pPhysicalSlot(size_t logicalBlockParm) const
+{
+    return (mHeadBlock + logicalBlockParm) & (mMapCapacity - 1);
+}
+
+/*Function name: pUsedBlocks
+  Input Parameters: None
+  Output: Number of map slots currently holding live elements
+  Purpose: Slots beyond this count (in ring order) are free for reuse by either end.
+*/
+template <typename T, typename Allocator>
+size_t Deque<T, Allocator>::pUsedBlocks() const
+{
+    return (mHeadOffset + mSize + BlockCapacity - 1) / BlockCapacity;
+}
+
+template <typename T, typename Allocator>
+T* Deque<T, Allocator>::pAllocateBlock()
+{
+    return mAllocator.allocateBlock(BlockCapacity);
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::pFreeBlock(T* blockParm)
+{
+    mAllocator.deallocateBlock(blockParm, BlockCapacity);
+}
+
+/*Function name: pGrowMap
+  Input Parameters: None
+  Output: None
+  Purpose: Doubles the block map, unrolling the ring so that the head block lands in slot 0.
+           Blocks (including spare ones) are carried over; no element is copied.
+*/
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::pGrowMap()
+{
+    size_t sNewCapacity = (mMapCapacity == 0) ? InitialMapCapacity : mMapCapacity * 2;
+    T** sNewMap = new T*[sNewCapacity]();
+    ++mMapAllocations;
+    for (size_t sI = 0; sI < mMapCapacity; ++sI)
     {
-        sCurrent = mTail;
-        for (size_t sI = mSize - 1; sI > indexParm; --sI)
-        {
-            sCurrent = sCurrent->mPrevious;
-        }
+        sNewMap[sI] = mMap[pPhysicalSlot(sI)];
     }
-    return sCurrent;
+    delete[] mMap;
+    mMap = sNewMap;
+    mMapCapacity = sNewCapacity;
+    mHeadBlock = 0;
 }
 
-template <typename T>
-void Deque<T>::push_back(const T &dataParm)
+template <typename T, typename Allocator>
+T* Deque<T, Allocator>::pElementAddress(size_t indexParm) const
 {
-    Node<T>* sNewNode = new Node<T>(dataParm);
-    if (empty())
+    size_t sPosition = mHeadOffset + indexParm;
+    return mMap[pPhysicalSlot(sPosition / BlockCapacity)] + (sPosition & (BlockCapacity - 1));
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::push_back(const T &dataParm)
+{
+    emplace_back(dataParm);
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::push_back(T &&dataParm)
+{
+    emplace_back(std::move(dataParm));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T& Deque<T, Allocator>::emplace_back(Args&&... argsParm)
+{
+    size_t sPosition = mHeadOffset + mSize;
+    size_t sLogicalBlock = sPosition / BlockCapacity;
+    if (sLogicalBlock >= mMapCapacity)
     {
-        mHead = mTail = sNewNode;
+        pGrowMap();
     }
-    else
+    T*& sBlock = mMap[pPhysicalSlot(sLogicalBlock)];
+    if (!sBlock)
     {
-        sNewNode->mPrevious = mTail;
-        mTail->mNext = sNewNode;
-        mTail = sNewNode;
+        sBlock = pAllocateBlock();
     }
+    T* sElement = new (sBlock + (sPosition & (BlockCapacity - 1))) T(std::forward<Args>(argsParm)...);
     mSize++;
+    return *sElement;
 }
 
-template <typename T>
-void Deque<T>::pop_back()
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::pop_back()
 {
     if (empty())
     {
         throw std::out_of_range("Cannot pop_back from an empty deque.");
     }
-    Node<T>* sTemp = mTail;
-    if (mHead == mTail) // Single element
-    {
-        mHead = mTail = nullptr;
-    }
-    else
-    {
-        mTail = mTail->mPrevious;
-        mTail->mNext = nullptr;
-    }
-    delete sTemp;
+    pElementAddress(mSize - 1)->~T();
     mSize--;
 }
 
-template <typename T>
-void Deque<T>::push_front(const T &dataParm)
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::push_front(const T &dataParm)
 {
-    Node<T>* sNewNode = new Node<T>(dataParm);
-    if (empty())
-    {
-        mHead = mTail = sNewNode;
-    }
-    else
+    emplace_front(dataParm);
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::push_front(T &&dataParm)
+{
+    emplace_front(std::move(dataParm));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T& Deque<T, Allocator>::emplace_front(Args&&... argsParm)
+{
+    if (mHeadOffset == 0)
     {
-        sNewNode->mNext = mHead;
-        mHead->mPrevious = sNewNode;
-        mHead = sNewNode;
+        // Step the head back one slot in the ring; the slot must not hold live elements.
+        if (mMapCapacity == 0 || pUsedBlocks() >= mMapCapacity)
+        {
+            pGrowMap();
+        }
+        mHeadBlock = (mHeadBlock + mMapCapacity - 1) & (mMapCapacity - 1);
+        mHeadOffset = BlockCapacity;
+        if (!mMap[mHeadBlock])
+        {
+            mMap[mHeadBlock] = pAllocateBlock();
+        }
     }
+    T* sElement = new (mMap[mHeadBlock] + (mHeadOffset - 1)) T(std::forward<Args>(argsParm)...);
+    mHeadOffset--;
     mSize++;
+    return *sElement;
 }
 
-template <typename T>
-void Deque<T>::pop_front()
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::pop_front()
 {
     if (empty())
     {
         throw std::out_of_range("Cannot pop_front from an empty deque.");
     }
-    Node<T>* sTemp = mHead;
-    if (mHead == mTail) // Single element
-    {
-        mHead = mTail = nullptr;
-    }
-    else
+    (mMap[mHeadBlock] + mHeadOffset)->~T();
+    mHeadOffset++;
+    mSize--;
+    if (mHeadOffset == BlockCapacity)
     {
-        mHead = mHead->mNext;
-        mHead->mPrevious = nullptr;
+        mHeadBlock = pPhysicalSlot(1);
+        mHeadOffset = 0;
     }
-    delete sTemp;
-    mSize--;
 }
 
-template <typename T>
-void Deque<T>::addAt(size_t indexParm, const T &dataParm)
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::addAt(size_t indexParm, const T &dataParm)
 {
     if (indexParm > mSize)
     {
         throw std::out_of_range("Index out of bounds for addAt");
     }
 
-    if (indexParm == 0)
+    if (indexParm < mSize / 2)
     {
+        // Open a slot at the front and bubble the new element forward.
         push_front(dataParm);
-    }
-    else if (indexParm == mSize)
-    {
-        push_back(dataParm);
+        for (size_t sI = 0; sI < indexParm; ++sI)
+        {
+            std::swap(*pElementAddress(sI), *pElementAddress(sI + 1));
+        }
     }
     else
     {
-        Node<T>* sCurrent = pGetNodeAt(indexParm);
-        Node<T>* sNewNode = new Node<T>(dataParm);
-
-        sNewNode->mPrevious = sCurrent->mPrevious;
-        sNewNode->mNext = sCurrent;
-        sCurrent->mPrevious->mNext = sNewNode;
-        sCurrent->mPrevious = sNewNode;
-        mSize++;
+        // Open a slot at the back and bubble the new element backward.
+        push_back(dataParm);
+        for (size_t sI = mSize - 1; sI > indexParm; --sI)
+        {
+            std::swap(*pElementAddress(sI), *pElementAddress(sI - 1));
+        }
     }
 }
 
-template <typename T>
-void Deque<T>::removeFrom(size_t indexParm)
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::removeFrom(size_t indexParm)
 {
     if (indexParm >= mSize)
     {
         throw std::out_of_range("Index out of bounds for removeFrom");
     }
 
-    if (indexParm == 0)
+    if (indexParm < mSize / 2)
     {
+        for (size_t sI = indexParm; sI > 0; --sI)
+        {
+            *pElementAddress(sI) = std::move(*pElementAddress(sI - 1));
+        }
         pop_front();
     }
-    else if (indexParm == mSize - 1)
+    else
     {
+        for (size_t sI = indexParm; sI + 1 < mSize; ++sI)
+        {
+            *pElementAddress(sI) = std::move(*pElementAddress(sI + 1));
+        }
         pop_back();
     }
+}
+
+template <typename T, typename Allocator>
+typename Deque<T, Allocator>::iterator Deque<T, Allocator>::insert(const_iterator positionParm, const T &dataParm)
+{
+    addAt(positionParm.mIndex, dataParm);
+    return iterator(this, positionParm.mIndex);
+}
+
+template <typename T, typename Allocator>
+typename Deque<T, Allocator>::iterator Deque<T, Allocator>::erase(const_iterator positionParm)
+{
+    removeFrom(positionParm.mIndex);
+    return iterator(this, positionParm.mIndex);
+}
+
+template <typename T, typename Allocator>
+typename Deque<T, Allocator>::iterator Deque<T, Allocator>::erase(const_iterator firstParm, const_iterator lastParm)
+{
+    size_t sFirst = firstParm.mIndex;
+    size_t sLast = lastParm.mIndex;
+    if (sFirst > sLast || sLast > mSize)
+    {
+        throw std::out_of_range("Invalid range for erase");
+    }
+    size_t sCount = sLast - sFirst;
+    if (sCount == 0)
+    {
+        return iterator(this, sFirst);
+    }
+
+    if (sFirst < mSize - sLast)
+    {
+        std::move_backward(begin(), begin() + sFirst, begin() + sLast);
+        for (size_t sI = 0; sI < sCount; ++sI)
+        {
+            pop_front();
+        }
+    }
     else
     {
-        Node<T>* sCurrent = pGetNodeAt(indexParm);
-        
-        sCurrent->mPrevious->mNext = sCurrent->mNext;
-        sCurrent->mNext->mPrevious = sCurrent->mPrevious;
+        std::move(begin() + sLast, end(), begin() + sFirst);
+        for (size_t sI = 0; sI < sCount; ++sI)
+        {
+            pop_back();
+        }
+    }
+    return iterator(this, sFirst);
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::splice(const_iterator positionParm, Deque& otherParm, const_iterator itParm)
+{
+    splice(positionParm, otherParm, itParm, itParm + 1);
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::splice(const_iterator positionParm, Deque& otherParm,
+                                 const_iterator firstParm, const_iterator lastParm)
+{
+    if (&otherParm == this)
+    {
+        throw std::invalid_argument("Cannot splice a deque into itself");
+    }
+    size_t sPosition = positionParm.mIndex;
+    size_t sFirst = firstParm.mIndex;
+    size_t sLast = lastParm.mIndex;
+    if (sPosition > mSize || sFirst > sLast || sLast > otherParm.mSize)
+    {
+        throw std::out_of_range("Invalid range for splice");
+    }
+    size_t sCount = sLast - sFirst;
 
-        delete sCurrent;
-        mSize--;
+    if (sPosition >= mSize - sPosition)
+    {
+        // Append at the back, then rotate the tail into place.
+        size_t sOldSize = mSize;
+        for (size_t sI = sFirst; sI < sLast; ++sI)
+        {
+            emplace_back(std::move(*otherParm.pElementAddress(sI)));
+        }
+        std::rotate(begin() + sPosition, begin() + sOldSize, end());
+    }
+    else
+    {
+        // Prepend at the front (in reverse), then rotate the head into place.
+        for (size_t sI = sLast; sI > sFirst; --sI)
+        {
+            emplace_front(std::move(*otherParm.pElementAddress(sI - 1)));
+        }
+        std::rotate(begin(), begin() + sCount, begin() + sCount + sPosition);
     }
+    otherParm.erase(firstParm, lastParm);
 }
 
-template <typename T>
-const T &Deque<T>::front() const
+template <typename T, typename Allocator>
+const T &Deque<T, Allocator>::front() const
 {
     if (empty())
     {
         throw std::out_of_range("Front from empty deque.");
     }
-    return mHead->mData;
+    return *pElementAddress(0);
 }
 
-template <typename T>
-const T &Deque<T>::back() const
+template <typename T, typename Allocator>
+const T &Deque<T, Allocator>::back() const
 {
     if (empty())
     {
         throw std::out_of_range("Back from empty deque.");
     }
-    return mTail->mData;
+    return *pElementAddress(mSize - 1);
 }
 
-template <typename T>
-bool Deque<T>::empty() const
+template <typename T, typename Allocator>
+bool Deque<T, Allocator>::empty() const
 {
     return mSize == 0;
 }
 
-template <typename T>
-size_t Deque<T>::size() const
+template <typename T, typename Allocator>
+size_t Deque<T, Allocator>::size() const
 {
     return mSize;
 }
 
-template <typename T>
-void Deque<T>::resize(size_t newSizeParm, const T &defaultValueParm, ResizeDirection directionParm)
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::resize(size_t newSizeParm, const T &defaultValueParm, ResizeDirection directionParm)
 {
     if (newSizeParm > mSize)
     {
@@ -339,15 +685,31 @@ void Deque<T>::resize(size_t newSizeParm, const T &defaultValueParm, ResizeDirec
 /*Function name: clear
   Input Parameters: None
   Output: None
-  Purpose: Clears all elements (nodes) from the deque. NOTE: Does not delete T* if T is a pointer type.
+  Purpose: Clears all elements from the deque and releases every block, the allocator's
+           slabs and the block map.
+           NOTE: Does not delete T* if T is a pointer type.
 */
-template <typename T>
-void Deque<T>::clear()
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::clear()
 {
-    while (!empty())
+    for (size_t sI = 0; sI < mSize; ++sI)
     {
-        pop_front();
+        pElementAddress(sI)->~T();
     }
+    for (size_t sI = 0; sI < mMapCapacity; ++sI)
+    {
+        if (mMap[sI])
+        {
+            pFreeBlock(mMap[sI]);
+        }
+    }
+    mAllocator.releaseAll();
+    delete[] mMap;
+    mMap = nullptr;
+    mMapCapacity = 0;
+    mHeadBlock = 0;
+    mHeadOffset = 0;
+    mSize = 0;
 }
 
 /*Function name: operator[]
@@ -355,15 +717,14 @@ void Deque<T>::clear()
   Output: Const reference to the element at the specified index
   Purpose: Provides read-only access to the element at 'index' in the deque.
 */
-template <typename T>
-const T& Deque<T>::operator[](size_t indexParm) const
+template <typename T, typename Allocator>
+const T& Deque<T, Allocator>::operator[](size_t indexParm) const
 {
-    Node<T>* sNode = pGetNodeAt(indexParm);
-    if (!sNode)
+    if (indexParm >= mSize)
     {
         throw std::out_of_range("Index out of bounds for const access");
     }
-    return sNode->mData;
+    return *pElementAddress(indexParm);
 }
 
 /*Function name: operator[]
@@ -371,15 +732,14 @@ const T& Deque<T>::operator[](size_t indexParm) const
   Output: Non-const reference to the element at the specified index
   Purpose: Provides read/write access to the element at 'index' in the deque.
 */
-template <typename T>
-T& Deque<T>::operator[](size_t indexParm) 
+template <typename T, typename Allocator>
+T& Deque<T, Allocator>::operator[](size_t indexParm)
 {
-    Node<T>* sNode = pGetNodeAt(indexParm);
-    if (!sNode)
+    if (indexParm >= mSize)
     {
         throw std::out_of_range("Index out of bounds for non-const access");
     }
-    return sNode->mData;
+    return *pElementAddress(indexParm);
 }
 
 #endif
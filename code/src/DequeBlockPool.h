@@ -0,0 +1,155 @@
+#ifndef DEQUE_BLOCK_POOL_H
+#define DEQUE_BLOCK_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include <utility>
+
+/**
+ * @class DequeBlockPool
+ * @brief Default block allocator for Deque: a slab/free-list pool.
+ *
+ * Blocks are carved out of slabs that each hold SlabBlocks blocks, so the
+ * global allocator is hit once per slab instead of once per block. Freed
+ * blocks go onto an intrusive free list and are handed out again before a
+ * new slab is requested. Every pool owns its slabs; releaseAll() (used by
+ * Deque::clear) returns whole slabs to the system.
+ */
+template <typename T>
+class DequeBlockPool
+{
+public:
+    enum PoolConstants { SlabBlocks = 16 };
+
+    DequeBlockPool() : mBlockElements(0), mFreeList(nullptr), mSystemAllocations(0) {}
+    DequeBlockPool(const DequeBlockPool&) = delete;
+    DequeBlockPool& operator=(const DequeBlockPool&) = delete;
+    ~DequeBlockPool() { releaseAll(); }
+
+    /**
+     * @brief Exchanges slabs and free lists; used when a Deque is moved.
+     */
+    void swap(DequeBlockPool& otherParm)
+    {
+        std::swap(mBlockElements, otherParm.mBlockElements);
+        std::swap(mFreeList, otherParm.mFreeList);
+        mSlabs.swap(otherParm.mSlabs);
+        std::swap(mSystemAllocations, otherParm.mSystemAllocations);
+    }
+
+    /**
+     * @brief Hands out uninitialized storage for elementsParm elements.
+     * @param elementsParm Block capacity; must be the same on every call.
+     */
+    T* allocateBlock(size_t elementsParm)
+    {
+        if (mBlockElements == 0)
+        {
+            mBlockElements = elementsParm;
+        }
+        else if (elementsParm != mBlockElements)
+        {
+            throw std::invalid_argument("DequeBlockPool serves a single block size.");
+        }
+        if (!mFreeList)
+        {
+            pAddSlab();
+        }
+        FreeBlock* sBlock = mFreeList;
+        mFreeList = sBlock->mNext;
+        return reinterpret_cast<T*>(sBlock);
+    }
+
+    /**
+     * @brief Returns a block to the free list for reuse (no system call).
+     */
+    void deallocateBlock(T* blockParm, size_t)
+    {
+        FreeBlock* sBlock = reinterpret_cast<FreeBlock*>(blockParm);
+        sBlock->mNext = mFreeList;
+        mFreeList = sBlock;
+    }
+
+    /**
+     * @brief Frees every slab. Only valid once all blocks have been handed back.
+     */
+    void releaseAll()
+    {
+        for (void* sSlab : mSlabs)
+        {
+            ::operator delete(sSlab);
+        }
+        mSlabs.clear();
+        mFreeList = nullptr;
+    }
+
+    /**
+     * @brief Number of allocations this pool has made from the global allocator.
+     */
+    size_t systemAllocations() const { return mSystemAllocations; }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* mNext;
+    };
+
+    void pAddSlab()
+    {
+        size_t sBlockBytes = mBlockElements * sizeof(T);
+        if (sBlockBytes < sizeof(FreeBlock))
+        {
+            sBlockBytes = sizeof(FreeBlock);
+        }
+        // Keep every block aligned for both T and the free-list link.
+        const size_t sAlign = alignof(T) > alignof(FreeBlock) ? alignof(T) : alignof(FreeBlock);
+        sBlockBytes = (sBlockBytes + sAlign - 1) / sAlign * sAlign;
+
+        char* sSlab = static_cast<char*>(::operator new(sBlockBytes * SlabBlocks));
+        mSlabs.push_back(sSlab);
+        ++mSystemAllocations;
+        for (size_t sI = SlabBlocks; sI > 0; --sI)
+        {
+            FreeBlock* sBlock = reinterpret_cast<FreeBlock*>(sSlab + (sI - 1) * sBlockBytes);
+            sBlock->mNext = mFreeList;
+            mFreeList = sBlock;
+        }
+    }
+
+    size_t mBlockElements;
+    FreeBlock* mFreeList;
+    std::vector<void*> mSlabs;
+    size_t mSystemAllocations;
+};
+
+/**
+ * @class DequeHeapAllocator
+ * @brief Unpooled block allocator: one global allocation per block.
+ *
+ * Useful as a baseline when comparing systemAllocations() against the pool.
+ */
+template <typename T>
+class DequeHeapAllocator
+{
+public:
+    DequeHeapAllocator() : mSystemAllocations(0) {}
+    DequeHeapAllocator(const DequeHeapAllocator&) = delete;
+    DequeHeapAllocator& operator=(const DequeHeapAllocator&) = delete;
+
+    T* allocateBlock(size_t elementsParm)
+    {
+        ++mSystemAllocations;
+        return static_cast<T*>(::operator new(elementsParm * sizeof(T)));
+    }
+    void deallocateBlock(T* blockParm, size_t) { ::operator delete(blockParm); }
+    void releaseAll() {}
+    size_t systemAllocations() const { return mSystemAllocations; }
+    void swap(DequeHeapAllocator& otherParm) { std::swap(mSystemAllocations, otherParm.mSystemAllocations); }
+
+private:
+    size_t mSystemAllocations;
+};
+
+#endif // DEQUE_BLOCK_POOL_H
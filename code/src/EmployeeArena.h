@@ -0,0 +1,153 @@
+#ifndef EMPLOYEE_ARENA_H
+#define EMPLOYEE_ARENA_H
+
+#include "XyzFullTimeEmployee.h"
+#include "XyzContractorEmployee.h"
+#include "XyzInternEmployee.h"
+#include "XyzResignedEmployee.h"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * @class EmployeeRecordPool
+ * @brief Slab storage for records of one concrete employee class.
+ *
+ * Slots are carved out of slabs of SlabRecords records, so the global
+ * allocator is hit once per slab. A slot handed back with deallocate() goes
+ * onto an intrusive free list and is reused before the slab is extended.
+ */
+template <typename T>
+class EmployeeRecordPool
+{
+public:
+    enum PoolConstants { SlabRecords = 1024 };
+
+    EmployeeRecordPool() : mFreeList(nullptr), mNext(nullptr), mEnd(nullptr), mLive(0) {}
+    EmployeeRecordPool(const EmployeeRecordPool&) = delete;
+    EmployeeRecordPool& operator=(const EmployeeRecordPool&) = delete;
+    ~EmployeeRecordPool() { releaseAll(); }
+
+    /**
+     * @brief Hands out uninitialized storage for one T.
+     */
+    void* allocate()
+    {
+        ++mLive;
+        if (mFreeList) {
+            FreeSlot* sSlot = mFreeList;
+            mFreeList = sSlot->mNext;
+            return sSlot;
+        }
+        if (mNext == mEnd) pAddSlab();
+        void* sSlot = mNext;
+        mNext += SlotBytes;
+        return sSlot;
+    }
+
+    /**
+     * @brief Returns a slot whose record has already been destroyed.
+     */
+    void deallocate(void* slotParm)
+    {
+        --mLive;
+        FreeSlot* sSlot = static_cast<FreeSlot*>(slotParm);
+        sSlot->mNext = mFreeList;
+        mFreeList = sSlot;
+    }
+
+    /**
+     * @brief Frees every slab at once. Destructors of live records are not run.
+     */
+    void releaseAll()
+    {
+        for (char* sSlab : mSlabs) ::operator delete(sSlab);
+        mSlabs.clear();
+        mFreeList = nullptr;
+        mNext = mEnd = nullptr;
+        mLive = 0;
+    }
+
+    size_t liveRecords() const { return mLive; }
+    size_t slabCount() const { return mSlabs.size(); }
+
+private:
+    struct FreeSlot
+    {
+        FreeSlot* mNext;
+    };
+
+    static constexpr size_t SlotAlign = alignof(T) > alignof(FreeSlot) ? alignof(T) : alignof(FreeSlot);
+    static constexpr size_t SlotSize = sizeof(T) > sizeof(FreeSlot) ? sizeof(T) : sizeof(FreeSlot);
+    static constexpr size_t SlotBytes = (SlotSize + SlotAlign - 1) / SlotAlign * SlotAlign;
+
+    void pAddSlab()
+    {
+        char* sSlab = static_cast<char*>(::operator new(SlotBytes * SlabRecords));
+        mSlabs.push_back(sSlab);
+        mNext = sSlab;
+        mEnd = sSlab + SlotBytes * SlabRecords;
+    }
+
+    FreeSlot* mFreeList;
+    char* mNext;
+    char* mEnd;
+    size_t mLive;
+    std::vector<char*> mSlabs;
+};
+
+/**
+ * @class EmployeeArena
+ * @brief Per-type record pools backing heap employee records.
+ *
+ * Records are built in place by EmployeeFactory. The arena owns their memory:
+ * a single record can be handed back with EmployeeFactory::destroy(), and
+ * releaseAll() (or the destructor) frees whole slabs without visiting each
+ * record. That is only valid because the record classes own no resources
+ * (names and genders are interned Symbols), so skipping their destructors
+ * leaks nothing. Not thread-safe.
+ */
+class EmployeeArena
+{
+public:
+    EmployeeArena() {}
+    EmployeeArena(const EmployeeArena&) = delete;
+    EmployeeArena& operator=(const EmployeeArena&) = delete;
+
+    template <typename T>
+    EmployeeRecordPool<T>& pool();
+
+    /**
+     * @brief Frees every record in the arena in one pass over its slabs.
+     */
+    void releaseAll()
+    {
+        mFullTime.releaseAll();
+        mContractors.releaseAll();
+        mInterns.releaseAll();
+        mResigned.releaseAll();
+    }
+
+    size_t liveRecords() const
+    {
+        return mFullTime.liveRecords() + mContractors.liveRecords() + mInterns.liveRecords() + mResigned.liveRecords();
+    }
+
+    size_t slabCount() const
+    {
+        return mFullTime.slabCount() + mContractors.slabCount() + mInterns.slabCount() + mResigned.slabCount();
+    }
+
+private:
+    EmployeeRecordPool<XyzFullTimeEmployee> mFullTime;
+    EmployeeRecordPool<XyzContractorEmployee> mContractors;
+    EmployeeRecordPool<XyzInternEmployee> mInterns;
+    EmployeeRecordPool<XyzResignedEmployee> mResigned;
+};
+
+template <> inline EmployeeRecordPool<XyzFullTimeEmployee>& EmployeeArena::pool() { return mFullTime; }
+template <> inline EmployeeRecordPool<XyzContractorEmployee>& EmployeeArena::pool() { return mContractors; }
+template <> inline EmployeeRecordPool<XyzInternEmployee>& EmployeeArena::pool() { return mInterns; }
+template <> inline EmployeeRecordPool<XyzResignedEmployee>& EmployeeArena::pool() { return mResigned; }
+
+#endif // EMPLOYEE_ARENA_H
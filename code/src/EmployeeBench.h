@@ -0,0 +1,35 @@
+#ifndef EMPLOYEE_BENCH_H
+#define EMPLOYEE_BENCH_H
+
+#include <cstddef>
+#include <string>
+
+class XyzEmployeeManager;
+
+/**
+ * @class EmployeeBenchmark
+ * @brief Reproducible measurements behind the single-threaded reporting optimizations.
+ *
+ * renderTables() times PrintService::printEmployeeSummaryTable against the
+ * iostream renderer it replaced, kept here verbatim as the baseline, writing
+ * to /dev/null and to a temporary file, and checks that both produce the same
+ * bytes. Rows come from the roster, topped up with random employees; main()
+ * hands it a scratch manager, so nothing generated here is persisted.
+ */
+class EmployeeBenchmark {
+public:
+    explicit EmployeeBenchmark(XyzEmployeeManager& managerParm);
+
+    /**
+     * @brief Renders a rowsParm-row summary table with both renderers and prints their times.
+     * @return false with errorOutParm set if the renderers disagree or no temporary file can be made.
+     */
+    bool renderTables(size_t rowsParm, std::string& errorOutParm);
+
+private:
+    void pFillRoster(size_t rowsParm);
+
+    XyzEmployeeManager& mManager;
+};
+
+#endif // EMPLOYEE_BENCH_H
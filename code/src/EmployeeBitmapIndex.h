@@ -0,0 +1,47 @@
+#ifndef EMPLOYEE_BITMAP_INDEX_H
+#define EMPLOYEE_BITMAP_INDEX_H
+
+#include "RoaringBitmap.h"
+#include "Enums.h"
+#include <optional>
+#include <cstdint>
+
+/**
+ * @struct EmployeeFilter
+ * @brief Conjunction of optional attribute predicates; an unset field matches everything.
+ */
+struct EmployeeFilter {
+    std::optional<EmployeeType> mType;
+    std::optional<EmployeeStatus> mStatus;
+    std::optional<Gender> mGender;
+};
+
+/**
+ * @class EmployeeBitmapIndex
+ * @brief Roaring bitmap secondary indexes keyed by type, status and gender.
+ *
+ * Bits are the manager's stable row numbers. Every row is present in exactly
+ * one bitmap per attribute, so the union of the type bitmaps is "all rows".
+ */
+class EmployeeBitmapIndex {
+public:
+    void add(uint32_t rowParm, EmployeeType typeParm, EmployeeStatus statusParm, Gender genderParm);
+    void remove(uint32_t rowParm, EmployeeType typeParm, EmployeeStatus statusParm, Gender genderParm);
+    void clear();
+
+    /**
+     * @brief Rows matching every set predicate of the filter.
+     */
+    RoaringBitmap select(const EmployeeFilter& filterParm) const;
+
+    const RoaringBitmap& byType(EmployeeType typeParm) const { return mByType[typeParm]; }
+    const RoaringBitmap& byStatus(EmployeeStatus statusParm) const { return mByStatus[statusParm]; }
+    const RoaringBitmap& byGender(Gender genderParm) const { return mByGender[genderParm]; }
+
+private:
+    RoaringBitmap mByType[MaxEmployeeTypes];
+    RoaringBitmap mByStatus[MaxEmployeeStatuses];
+    RoaringBitmap mByGender[MaxGenders];
+};
+
+#endif // EMPLOYEE_BITMAP_INDEX_H
@@ -0,0 +1,105 @@
+#ifndef EMPLOYEE_COLUMN_STORE_H
+#define EMPLOYEE_COLUMN_STORE_H
+
+#include "Deque.h"
+#include "EmployeeFactory.h"
+#include "EmployeeBitmapIndex.h"
+#include "EmployeeRowHandle.h"
+#include "CivilDate.h"
+#include "EmployeeId.h"
+#include "SymbolTable.h"
+#include "Enums.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class EmployeeColumnStore
+ * @brief Struct-of-arrays employee storage: one vector per field, indexed by row.
+ *
+ * Common fields (ID, name, type, status, gender, DOB/DOJ/DOL) are dense columns.
+ * Type-specific fields live in sparse side columns: mDetailSlot[row] points into
+ * the leaves column for full-time rows, the agency column for contractors, or
+ * the college/branch columns for interns, and is NoDetail for records created
+ * as resigned. Scans such as countMatching() and addLeavesToType() read only the
+ * columns they test or update.
+ *
+ * Each row has an EmployeeRowHandle that implements XyzEmployeeIF on top of the
+ * columns, so rosters and indexes keep working with XyzEmployeeIF*. Handles are
+ * kept in a Deque, so their addresses stay fixed as rows are appended.
+ */
+class EmployeeColumnStore {
+public:
+    enum ColumnStoreConstants { NoDetail = 0xFFFFFFFFu };
+
+    EmployeeColumnStore() {}
+    EmployeeColumnStore(const EmployeeColumnStore&) = delete;
+    EmployeeColumnStore& operator=(const EmployeeColumnStore&) = delete;
+
+    uint32_t append(const NewEmployeeArgs& argsParm);
+    void assign(uint32_t rowParm, const NewEmployeeArgs& argsParm);
+    void clear();
+
+    size_t size() const { return mIds.size(); }
+    XyzEmployeeIF* handle(uint32_t rowParm) { return &mHandles[rowParm]; }
+
+    // Column reads
+    EmployeeId id(uint32_t rowParm) const { return mIds[rowParm]; }
+    Symbol name(uint32_t rowParm) const { return mNames[rowParm]; }
+    EmployeeType type(uint32_t rowParm) const { return static_cast<EmployeeType>(mTypes[rowParm]); }
+    EmployeeStatus status(uint32_t rowParm) const { return static_cast<EmployeeStatus>(mStatuses[rowParm]); }
+    Gender gender(uint32_t rowParm) const { return static_cast<Gender>(mGenders[rowParm]); }
+    CivilDate dob(uint32_t rowParm) const { return mDob[rowParm]; }
+    CivilDate doj(uint32_t rowParm) const { return mDoj[rowParm]; }
+    CivilDate dol(uint32_t rowParm) const { return mDol[rowParm]; }
+    bool hasDetails(uint32_t rowParm) const { return mDetailSlot[rowParm] != NoDetail; }
+    int leaves(uint32_t rowParm) const;
+    Agency agency(uint32_t rowParm) const { return static_cast<Agency>(mAgencies[mDetailSlot[rowParm]]); }
+    College college(uint32_t rowParm) const { return static_cast<College>(mColleges[mDetailSlot[rowParm]]); }
+    Branch branch(uint32_t rowParm) const { return static_cast<Branch>(mBranches[mDetailSlot[rowParm]]); }
+
+    // Column writes
+    void setStatus(uint32_t rowParm, EmployeeStatus statusParm) { mStatuses[rowParm] = static_cast<uint8_t>(statusParm); }
+    void setDol(uint32_t rowParm, CivilDate dolParm) { mDol[rowParm] = dolParm; }
+    void addLeaves(uint32_t rowParm, int leavesParm);
+
+    /**
+     * @brief Counts rows matching the filter, reading only the constrained columns.
+     */
+    size_t countMatching(const EmployeeFilter& filterParm) const;
+
+    /**
+     * @brief Adds leaves to every non-resigned row of the given type; returns the number updated.
+     */
+    size_t addLeavesToType(EmployeeType typeParm, int leavesParm);
+
+    /**
+     * @brief Approximate bytes held by the columns (name text lives in the SymbolTable).
+     */
+    size_t memoryUsage() const;
+
+private:
+    uint32_t pAllocateDetail(const NewEmployeeArgs& argsParm);
+
+    // Dense columns, one entry per row
+    std::vector<EmployeeId> mIds;
+    std::vector<Symbol> mNames;
+    std::vector<uint8_t> mTypes;
+    std::vector<uint8_t> mStatuses;
+    std::vector<uint8_t> mGenders;
+    std::vector<CivilDate> mDob;
+    std::vector<CivilDate> mDoj;
+    std::vector<CivilDate> mDol;
+    std::vector<uint32_t> mDetailSlot;
+
+    // Sparse type-specific columns, indexed by mDetailSlot
+    std::vector<uint8_t> mLeaves;    // full-time
+    std::vector<uint8_t> mAgencies;  // contractor
+    std::vector<uint8_t> mColleges;  // intern
+    std::vector<uint8_t> mBranches;  // intern
+
+    Deque<EmployeeRowHandle> mHandles;
+};
+
+#endif // EMPLOYEE_COLUMN_STORE_H
@@ -0,0 +1,99 @@
+#ifndef EMPLOYEE_COMMAND_H
+#define EMPLOYEE_COMMAND_H
+
+#include "EmployeeImport.h"
+#include "Enums.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class XyzEmployeeManager;
+
+/**
+ * @class EmployeeCommandInterpreter
+ * @brief Runs one-line text commands against a manager and formats compact replies.
+ *
+ * A command is a word followed by arguments separated by blanks; an argument
+ * containing blanks is written in double quotes. Blank lines and lines
+ * starting with '#' are skipped. Every other line gets one reply line,
+ * "ok ..." or "error <kind> <message>" (kind: usage, bad-argument,
+ * not-found, not-allowed, unknown-command). Commands that return employees
+ * give the row count in the reply line and follow it with that many CSV
+ * rows in the export's default columns (EmployeeExportSink::defaultColumns).
+ *
+ *   add TYPE NAME GENDER DOB DOJ [STATUS [DOL]]        ok ID
+ *   bulk-random COUNT                                  ok COUNT   (COUNT at most MaxBulkRandom)
+ *   resign ID [DOL]                                    ok     (DOL defaults to today, even before the DOJ)
+ *   convert ID                                         ok     (intern or contractor to full-time)
+ *   add-leaves COUNT                                   ok UPDATED
+ *   find-id ID                                         ok 1 + row
+ *   find-name NAME [LIMIT]                             ok ROWS + rows (whole name, any case)
+ *   find-prefix PREFIX [LIMIT]                         ok ROWS + rows
+ *   summary [type=T] [status=S] [gender=G] [limit=N]   ok MATCHES ROWS + rows
+ *
+ * Commands go straight to the manager's result-returning operations, so
+ * nothing is drawn or prompted for. Not thread-safe.
+ */
+class EmployeeCommandInterpreter {
+public:
+    explicit EmployeeCommandInterpreter(XyzEmployeeManager& managerParm);
+
+    /**
+     * @brief Executes one line and appends its reply to replyOutParm (nothing for blank or comment lines).
+     */
+    void execute(std::string_view lineParm, std::string& replyOutParm);
+
+    /**
+     * @brief Executes every line read from inFdParm, writing the replies to outFdParm.
+     *
+     * Input is read and replies are written in CommandBufferBytes blocks; the
+     * replies so far are written out before every read, so a client that
+     * waits for each reply before sending the next command is not stalled.
+     * @return false with errorOutParm set if reading or writing fails.
+     */
+    bool run(int inFdParm, int outFdParm, std::string& errorOutParm);
+
+    size_t commands() const { return mCommands; }
+
+private:
+    typedef void (EmployeeCommandInterpreter::*Handler)(const std::string_view* argsParm, size_t countParm,
+                                                        std::string& replyParm);
+
+    /**
+     * One command word: its handler and how many arguments it takes.
+     */
+    struct Command {
+        const char* mName;
+        Handler mHandler;
+        size_t mMinArgs;
+        size_t mMaxArgs;
+        const char* mUsage;
+    };
+
+    static const Command sCommands[];
+
+    void pAdd(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pBulkRandom(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pResign(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pConvert(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pAddLeaves(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pFindId(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pFindName(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pFindPrefix(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+    void pSummary(const std::string_view* argsParm, size_t countParm, std::string& replyParm);
+
+    void pFindByName(const std::string_view* argsParm, size_t countParm, bool prefixParm, std::string& replyParm);
+    void pReplyRows(const char* headParm, std::string& replyParm);
+    static void pReplyResult(OperationResult resultParm, std::string& replyParm);
+    static void pReplyError(const char* kindParm, std::string_view messageParm, std::string& replyParm);
+    static bool pTokenize(std::string_view lineParm, std::string_view* argsOutParm, size_t& countOutParm);
+
+    XyzEmployeeManager& mManager;
+    std::vector<ImportColumn> mColumns;
+    std::string mRows;       // rows of the reply being built, counted in mRowCount
+    size_t mRowCount;
+    size_t mCommands;
+};
+
+#endif // EMPLOYEE_COMMAND_H
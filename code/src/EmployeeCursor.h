@@ -0,0 +1,34 @@
+#ifndef EMPLOYEE_CURSOR_H
+#define EMPLOYEE_CURSOR_H
+
+#include "EmployeeBitmapIndex.h"
+#include "Enums.h"
+#include <cstdint>
+
+/**
+ * @struct EmployeePosition
+ * @brief A place in report order: a phase and a row number within it.
+ *
+ * Reports list current (active/inactive) employees first and resigned ones
+ * after, each in row order. Rows are never renumbered, so a position stays
+ * valid while employees are added, converted or resigned.
+ */
+struct EmployeePosition {
+    CursorPhase mPhase = CursorCurrentRows;
+    uint32_t mRow = 0;
+};
+
+/**
+ * @struct EmployeeCursor
+ * @brief Resumable state of a paged report (see XyzEmployeeManager::openCursor).
+ *
+ * The page last delivered starts at mBegin; mEnd is just past its last row, so
+ * the next page starts there and the previous one ends before mBegin.
+ */
+struct EmployeeCursor {
+    EmployeeFilter mFilter;
+    EmployeePosition mBegin;
+    EmployeePosition mEnd;
+};
+
+#endif // EMPLOYEE_CURSOR_H
@@ -0,0 +1,86 @@
+#ifndef EMPLOYEE_EXPORT_H
+#define EMPLOYEE_EXPORT_H
+
+#include "EmployeeRowSink.h"
+#include "EmployeeImport.h"
+#include "Enums.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class EmployeeExportSink
+ * @brief Report pipeline sink that writes records as CSV or NDJSON.
+ *
+ * Columns carry the import names (EmployeeImportParser::columnName), so an
+ * export can be imported again. Fields that do not apply to an employee are
+ * written empty in CSV and as null in NDJSON. Rows are formatted by
+ * appendRecord() into a buffer that is written out whenever it holds
+ * ExportBufferBytes, so memory use does not depend on the number of rows, and the
+ * output may be a pipe or a FIFO as well as a regular file.
+ */
+class EmployeeExportSink : public EmployeeRowSink {
+public:
+    EmployeeExportSink(RecordFormat formatParm, const std::vector<ImportColumn>& columnsParm);
+    ~EmployeeExportSink();
+
+    EmployeeExportSink(const EmployeeExportSink&) = delete;
+    EmployeeExportSink& operator=(const EmployeeExportSink&) = delete;
+
+    /**
+     * @brief Creates or truncates pathParm ("-" for standard output) and writes the CSV header.
+     * @return false with error() set if the file cannot be opened.
+     */
+    bool open(const std::string& pathParm);
+
+    /**
+     * @brief Formats one record; returns false once a write has failed.
+     */
+    bool accept(const XyzEmployeeIF& employeeParm) override;
+
+    /**
+     * @brief Writes out what is buffered and closes the output.
+     * @return false if any write failed; see error().
+     */
+    bool finish();
+
+    size_t rows() const { return mRows; }
+    const std::string& error() const { return mError; }
+
+    /**
+     * @brief Appends one record as a CSV or NDJSON line (newline included) to outParm.
+     */
+    static void appendRecord(const XyzEmployeeIF& employeeParm, RecordFormat formatParm,
+                             const std::vector<ImportColumn>& columnsParm, std::string& outParm);
+
+    /**
+     * @brief Appends the CSV header line naming columnsParm to outParm.
+     */
+    static void appendHeader(const std::vector<ImportColumn>& columnsParm, std::string& outParm);
+
+    /**
+     * @brief Every column, in the order exports use by default.
+     */
+    static std::vector<ImportColumn> defaultColumns();
+
+    /**
+     * @brief Parses a comma-separated column list such as "id,name,type".
+     * @return false with errorOutParm set if a name is unknown, repeated or the list is empty.
+     */
+    static bool parseColumns(std::string_view listParm, std::vector<ImportColumn>& columnsOutParm,
+                             std::string& errorOutParm);
+
+private:
+    void pFlush();
+
+    RecordFormat mFormat;
+    std::vector<ImportColumn> mColumns;
+    int mFd;
+    bool mOwnsFd;
+    std::string mPath;
+    std::string mBuffer;
+    size_t mRows;
+    std::string mError;
+};
+
+#endif // EMPLOYEE_EXPORT_H
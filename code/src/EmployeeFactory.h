@@ -4,14 +4,17 @@
 #include "XyzEmployeeIF.h"
 #include "Enums.h"
 #include <string>
+#include <cstddef>
+
+class EmployeeArena;
 
 struct NewEmployeeArgs {
-    std::string mName;
-    std::string mId;
-    std::string mGender;
-    std::string mDob;
-    std::string mDoj;
-    std::string mDol; // "-" if not applicable
+    Symbol mName;
+    EmployeeId mId;
+    Symbol mGender;
+    CivilDate mDob;
+    CivilDate mDoj;
+    CivilDate mDol; // none if not applicable
     EmployeeType mType;
     EmployeeStatus mStatus;
 
@@ -19,11 +22,15 @@ struct NewEmployeeArgs {
     Agency mAgency = Avengers;    // for Contractor
     College mCollege = IITDelhi;  // for Intern
     Branch mBranch = CSE;         // for Intern
+    bool mKeepDetails = false;    // Resigned only: keep the fields above (resigned after creation)
 };
 
 class EmployeeFactory {
 public:
-    static XyzEmployeeIF* create(const NewEmployeeArgs& argsParm);
+    static XyzEmployeeIF* create(const NewEmployeeArgs& argsParm, EmployeeArena& arenaParm);
+    static void createBatch(const NewEmployeeArgs* argsParm, size_t countParm, EmployeeArena& arenaParm,
+                            XyzEmployeeIF** recordsOutParm);
+    static void destroy(XyzEmployeeIF* employeeParm, EmployeeArena& arenaParm);
 };
 
-#endif // EMPLOYEE_FACTORY_H
\ No newline at end of file
+#endif // EMPLOYEE_FACTORY_H
@@ -0,0 +1,74 @@
+#ifndef EMPLOYEE_FIELD_VISITOR_H
+#define EMPLOYEE_FIELD_VISITOR_H
+
+#include <string_view>
+#include <string>
+#include <deque>
+#include <cstddef>
+#include "SymbolTable.h"
+#include "EmployeeId.h"
+#include "CivilDate.h"
+#include "Enums.h"
+
+struct EmployeeSummary;
+
+/**
+ * @class EmployeeFieldVisitor
+ * @brief Receives an employee's displayable fields from XyzEmployeeIF::visitFields.
+ *
+ * Each value is a view that is only valid for the duration of the call: labels
+ * and names point into the SymbolTable, while IDs, dates and numbers are
+ * formatted into the caller's stack buffers. Fields that do not apply to the
+ * employee (e.g. agency for an intern) are not visited.
+ */
+class EmployeeFieldVisitor {
+public:
+    virtual void visitField(EmployeeField fieldParm, std::string_view valueParm) = 0;
+    virtual ~EmployeeFieldVisitor() {}
+
+    /**
+     * @brief Visits the fields every employee has (name through DOL).
+     * @param dolParm Date of leaving; none is visited as "-".
+     */
+    void visitCommonFields(Symbol nameParm, EmployeeId idParm, Symbol genderParm,
+                           EmployeeType typeParm, EmployeeStatus statusParm,
+                           CivilDate dobParm, CivilDate dojParm, CivilDate dolParm);
+
+    /**
+     * @brief Formats an integer field without allocating and visits it.
+     */
+    void visitIntField(EmployeeField fieldParm, int valueParm);
+
+    /**
+     * @brief Visits a summary row's fields, as XyzEmployeeIF::visitFields does for the record.
+     */
+    void visitSummary(const EmployeeSummary& summaryParm);
+};
+
+/**
+ * @class EmployeeRowCells
+ * @brief Projects one record's visited fields into a row of display cells.
+ *
+ * Visited values are copied into a fixed buffer because they are only valid
+ * during the callback; fields that are not visited keep their "-" placeholder.
+ * Reset and reuse one instance per table rather than creating one per row.
+ */
+class EmployeeRowCells : public EmployeeFieldVisitor {
+public:
+    EmployeeRowCells() { reset(); }
+
+    void reset();
+    void visitField(EmployeeField fieldParm, std::string_view valueParm) override;
+
+    const std::string_view* cells() const { return mCells; }
+
+private:
+    enum RowCellsConstants { BufferBytes = 256 };
+
+    char mBuffer[BufferBytes];
+    size_t mUsed;
+    std::deque<std::string> mOverflow;
+    std::string_view mCells[MaxEmployeeFields];
+};
+
+#endif // EMPLOYEE_FIELD_VISITOR_H
@@ -2,16 +2,16 @@
 #define EMPLOYEE_ID_GENERATOR_H
 
 #include <string>
-#include <sstream>
-#include <iomanip>
+#include <cstdint>
+#include "EmployeeId.h"
 #include "Enums.h"
 
 /**
  * @class EmployeeIDGenerator
- * @brief A utility class to generate formatted employee IDs.
+ * @brief A utility class to generate employee IDs.
  *
- * This class provides a static method to create employee IDs according to the
- * format "XYZ" + 4-digit numeric code + Type Code (F/C/I).
+ * IDs have the format "XYZ" + numeric code (at least 4 digits) + Type Code (F/C/I)
+ * and are carried around as compact EmployeeId values.
  */
 class EmployeeIDGenerator {
 public:
@@ -19,18 +19,20 @@ public:
      * @brief Generates a unique employee ID based on type and a counter.
      * @param typeParm The type of the employee (FullTime, Contractor, Intern).
      * @param counterParm A unique number for the employee.
-     * @return A formatted employee ID string.
+     * @return The employee ID value.
      */
-    static std::string generateID(EmployeeType typeParm, int counterParm) {
-        std::ostringstream sStream;
-        sStream << "XYZ" << std::setw(EmployeeIdNumericLength) << std::setfill('0') << counterParm;
+    static EmployeeId generate(EmployeeType typeParm, uint64_t counterParm) {
+        return EmployeeId(counterParm, typeParm);
+    }
 
-        switch (typeParm) {
-            case FullTime:   sStream << 'F'; break;
-            case Contractor: sStream << 'C'; break;
-            case Intern:     sStream << 'I'; break;
-        }
-        return sStream.str();
+    /**
+     * @brief Generates a unique employee ID and formats it.
+     * @param typeParm The type of the employee (FullTime, Contractor, Intern).
+     * @param counterParm A unique number for the employee.
+     * @return A formatted employee ID string.
+     */
+    static std::string generateID(EmployeeType typeParm, uint64_t counterParm) {
+        return generate(typeParm, counterParm).toString();
     }
 };
 
@@ -0,0 +1,134 @@
+#ifndef EMPLOYEE_ID_H
+#define EMPLOYEE_ID_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <functional>
+#include "Enums.h"
+
+/**
+ * @class EmployeeId
+ * @brief Compact employee identifier: a sequence number plus a type tag.
+ *
+ * Both parts are packed into one 64-bit word (sequence << 2 | tag), so equality,
+ * ordering and hashing are single integer operations; ordering follows the
+ * sequence. The textual form is "XYZ" + sequence (zero-padded to at least
+ * EmployeeIdNumericLength digits, growing as needed) + 'F'/'C'/'I'.
+ * Sequence 0 is reserved for the invalid/empty ID.
+ */
+class EmployeeId {
+public:
+    enum EmployeeIdConstants {
+        TagBits = 2,
+        MaxDigits = 19,                                              // 2^62 - 1 has 19 digits
+        MaxFormattedLength = EmployeeIdPrefixLength + MaxDigits + 1
+    };
+
+    constexpr EmployeeId() : mValue(0) {}
+    constexpr EmployeeId(uint64_t sequenceParm, EmployeeType typeParm)
+        : mValue((sequenceParm << TagBits) | static_cast<uint64_t>(typeParm)) {}
+
+    constexpr uint64_t sequence() const { return mValue >> TagBits; }
+    constexpr EmployeeType typeTag() const { return static_cast<EmployeeType>(mValue & ((1u << TagBits) - 1)); }
+    constexpr uint64_t raw() const { return mValue; }
+    constexpr bool isValid() const { return sequence() != 0; }
+
+    static constexpr EmployeeId fromRaw(uint64_t rawParm) { EmployeeId sId; sId.mValue = rawParm; return sId; }
+
+    /**
+     * @brief Formats into [firstParm, lastParm) without allocating.
+     * @return Pointer one past the last written character, or nullptr if the buffer is too small.
+     */
+    char* toChars(char* firstParm, char* lastParm) const
+    {
+        char sDigits[MaxDigits];
+        size_t sCount = 0;
+        uint64_t sSeq = sequence();
+        do {
+            sDigits[sCount++] = static_cast<char>('0' + sSeq % 10);
+            sSeq /= 10;
+        } while (sSeq != 0);
+        size_t sWidth = sCount < static_cast<size_t>(EmployeeIdNumericLength) ? EmployeeIdNumericLength : sCount;
+        if (static_cast<size_t>(lastParm - firstParm) < EmployeeIdPrefixLength + sWidth + 1) return nullptr;
+
+        char* sOut = firstParm;
+        *sOut++ = 'X'; *sOut++ = 'Y'; *sOut++ = 'Z';
+        for (size_t sI = sCount; sI < sWidth; ++sI) *sOut++ = '0';
+        while (sCount > 0) *sOut++ = sDigits[--sCount];
+        *sOut++ = pTagChar(typeTag());
+        return sOut;
+    }
+
+    std::string toString() const
+    {
+        char sBuffer[MaxFormattedLength];
+        return std::string(sBuffer, toChars(sBuffer, sBuffer + sizeof(sBuffer)));
+    }
+
+    /**
+     * @brief Parses "XYZ<digits><F|C|I>" (letters case-insensitive).
+     * @return false if the text is not a well-formed, non-zero ID.
+     */
+    static bool parse(std::string_view textParm, EmployeeId& idOutParm)
+    {
+        size_t sLen = textParm.size();
+        if (sLen < static_cast<size_t>(EmployeeIdPrefixLength) + 2 ||
+            sLen > static_cast<size_t>(MaxFormattedLength)) return false;
+        if ((textParm[0] | 0x20) != 'x' || (textParm[1] | 0x20) != 'y' || (textParm[2] | 0x20) != 'z') return false;
+
+        EmployeeType sType;
+        switch (textParm[sLen - 1] | 0x20) {
+            case 'f': sType = FullTime; break;
+            case 'c': sType = Contractor; break;
+            case 'i': sType = Intern; break;
+            default:  return false;
+        }
+
+        uint64_t sSeq = 0;
+        for (size_t sI = EmployeeIdPrefixLength; sI + 1 < sLen; ++sI) {
+            unsigned sDigit = static_cast<unsigned>(textParm[sI] - '0');
+            if (sDigit > 9) return false;
+            sSeq = sSeq * 10 + sDigit;
+        }
+        if (sSeq == 0 || sSeq > (~uint64_t(0) >> TagBits)) return false;
+        idOutParm = EmployeeId(sSeq, sType);
+        return true;
+    }
+
+    constexpr bool operator==(const EmployeeId& otherParm) const { return mValue == otherParm.mValue; }
+    constexpr bool operator!=(const EmployeeId& otherParm) const { return mValue != otherParm.mValue; }
+    constexpr bool operator<(const EmployeeId& otherParm) const { return mValue < otherParm.mValue; }
+    constexpr bool operator>(const EmployeeId& otherParm) const { return mValue > otherParm.mValue; }
+    constexpr bool operator<=(const EmployeeId& otherParm) const { return mValue <= otherParm.mValue; }
+    constexpr bool operator>=(const EmployeeId& otherParm) const { return mValue >= otherParm.mValue; }
+
+    /**
+     * @brief 64-bit mix (splitmix64 finalizer) so sequential IDs spread across hash buckets.
+     */
+    constexpr size_t hash() const
+    {
+        uint64_t sX = mValue;
+        sX = (sX ^ (sX >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        sX = (sX ^ (sX >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<size_t>(sX ^ (sX >> 31));
+    }
+
+private:
+    static constexpr char pTagChar(EmployeeType typeParm)
+    {
+        return typeParm == FullTime ? 'F' : (typeParm == Contractor ? 'C' : 'I');
+    }
+
+    uint64_t mValue;
+};
+
+namespace std {
+template <>
+struct hash<EmployeeId> {
+    size_t operator()(const EmployeeId& idParm) const { return idParm.hash(); }
+};
+}
+
+#endif // EMPLOYEE_ID_H
@@ -0,0 +1,74 @@
+#ifndef EMPLOYEE_ID_INDEX_H
+#define EMPLOYEE_ID_INDEX_H
+
+#include "XyzEmployeeIF.h"
+#include "EmployeeId.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct EmployeeLocation
+ * @brief Where an employee record currently lives.
+ */
+struct EmployeeLocation {
+    XyzEmployeeIF* mEmployee = nullptr;
+    bool mIsResigned = false;    // true -> resigned roster, false -> active/inactive roster
+    uint32_t mRow = 0;           // stable row number used by the bitmap indexes
+};
+
+/**
+ * @class EmployeeIdIndex
+ * @brief Open-addressing hash index from employee ID to record location.
+ *
+ * Linear probing over a power-of-two table keyed directly on the packed
+ * EmployeeId, so every probe is a single integer compare; the invalid ID
+ * marks an empty slot. Erasure uses backward-shift deletion, so no
+ * tombstones accumulate.
+ */
+class EmployeeIdIndex {
+public:
+    EmployeeIdIndex();
+
+    /**
+     * @brief Inserts or overwrites the location for an ID.
+     */
+    void insert(EmployeeId idParm, const EmployeeLocation& locationParm);
+
+    /**
+     * @brief Looks an ID up.
+     * @return Pointer to the stored location, or nullptr when absent.
+     */
+    EmployeeLocation* find(EmployeeId idParm);
+    const EmployeeLocation* find(EmployeeId idParm) const;
+
+    /**
+     * @brief Removes an ID.
+     * @return true if the ID was present.
+     */
+    bool erase(EmployeeId idParm);
+
+    /**
+     * @brief Grows the table so that countParm IDs fit without further rehashing.
+     */
+    void reserve(size_t countParm);
+
+    void clear();
+    size_t size() const { return mSize; }
+
+private:
+    struct Slot {
+        EmployeeId mKey;                // invalid ID <=> empty slot
+        EmployeeLocation mLocation;
+    };
+
+    enum IndexConstants { InitialCapacity = 64, MaxLoadPercent = 70 };
+
+    size_t pFindSlot(EmployeeId idParm) const;
+    void pRehash(size_t newCapacityParm);
+
+    std::vector<Slot> mSlots;
+    size_t mSize;
+};
+
+#endif // EMPLOYEE_ID_INDEX_H
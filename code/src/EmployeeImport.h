@@ -0,0 +1,163 @@
+#ifndef EMPLOYEE_IMPORT_H
+#define EMPLOYEE_IMPORT_H
+
+#include "CivilDate.h"
+#include "Enums.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Fields an import row can carry. CSV header cells and NDJSON keys use
+ * the names in EmployeeImportParser::columnName(); unknown ones are ignored.
+ */
+enum ImportColumn {
+    ImportName,
+    ImportGender,
+    ImportDob,
+    ImportDoj,
+    ImportType,
+    ImportStatus,
+    ImportDol,
+    ImportLeaves,
+    ImportAgency,
+    ImportCollege,
+    ImportBranch,
+    ImportId,
+    MaxImportColumns
+};
+
+/**
+ * @struct ImportRow
+ * @brief One parsed and validated row. mName points into the mapped input file.
+ */
+struct ImportRow {
+    std::string_view mName;
+    uint64_t mId = 0;              // EmployeeId::raw(); 0 = assign a new ID
+    CivilDate mDob;
+    CivilDate mDoj;
+    CivilDate mDol;                // none unless given
+    uint32_t mLine = 0;            // line number within the chunk, from 0
+    uint32_t mOffset = 0;          // where the line starts within the chunk
+    int8_t mLeaves = -1;           // -1 = not given (drawn at random, as for manual entry)
+    int8_t mAgency = -1;
+    int8_t mCollege = -1;
+    int8_t mBranch = -1;
+    Gender mGender = Male;
+    EmployeeType mType = FullTime;
+    EmployeeStatus mStatus = Active;
+};
+
+/**
+ * @struct ImportReject
+ * @brief A rejected line: why, and the line itself (pointing into the mapped file).
+ */
+struct ImportReject {
+    uint32_t mLine;
+    const char* mReason;
+    std::string_view mText;
+};
+
+/**
+ * @struct ImportChunk
+ * @brief A run of whole lines and what parsing them produced.
+ */
+struct ImportChunk {
+    std::string_view mText;
+    size_t mLines = 0;
+    bool mHasIds = false;          // some row names its own ID
+    std::vector<ImportRow> mRows;
+    std::vector<ImportReject> mRejects;
+
+    /**
+     * @brief The line starting at offsetParm, without its line break.
+     */
+    std::string_view lineAt(uint32_t offsetParm) const
+    {
+        std::string_view sLine = mText.substr(offsetParm);
+        sLine = sLine.substr(0, sLine.find('\n'));
+        if (!sLine.empty() && sLine.back() == '\r') sLine.remove_suffix(1);
+        return sLine;
+    }
+};
+
+/**
+ * @class ImportSource
+ * @brief Read-only memory mapping of an import file.
+ */
+class ImportSource {
+public:
+    ImportSource();
+    ~ImportSource();
+
+    ImportSource(const ImportSource&) = delete;
+    ImportSource& operator=(const ImportSource&) = delete;
+
+    bool open(const std::string& pathParm, std::string& errorOutParm);
+    std::string_view text() const { return std::string_view(mData, mSize); }
+
+private:
+    const char* mData;
+    size_t mSize;
+};
+
+/**
+ * @class EmployeeImportParser
+ * @brief Slices and validates CSV or NDJSON rows without copying them.
+ *
+ * Fields are string_views into the mapped file and every check is done on
+ * those views (CivilDate::parse, HelperFunctions::parseGender and friends),
+ * so parsing allocates nothing per row but the output vectors. parse() only
+ * reads the parser and its chunk, so chunks can be parsed on several
+ * threads at once. CSV fields may be quoted but must not contain quotes or
+ * line breaks; NDJSON values must not contain escape sequences. Rows that
+ * break these rules are rejected, not misread.
+ */
+class EmployeeImportParser {
+public:
+    explicit EmployeeImportParser(RecordFormat formatParm);
+
+    /**
+     * @brief Maps the CSV header's cells to columns.
+     * @return false with errorOutParm set if a required column is missing.
+     */
+    bool readHeader(std::string_view lineParm, std::string& errorOutParm);
+
+    void parse(ImportChunk& chunkParm) const;
+
+    /**
+     * @brief Parses chunksParm on up to hardware_concurrency() threads.
+     */
+    void parseAll(std::vector<ImportChunk>& chunksParm) const;
+
+    /**
+     * @brief Cuts textParm into runs of about chunkBytesParm bytes that end on line boundaries.
+     */
+    static void split(std::string_view textParm, size_t chunkBytesParm, std::vector<std::string_view>& chunksOutParm);
+
+    /**
+     * @brief Checks one row's fields, indexed by ImportColumn (missing ones empty).
+     * @return Rejection reason, or nullptr with rowOutParm filled in.
+     */
+    static const char* validate(const std::string_view* fieldsParm, ImportRow& rowOutParm);
+
+    static const char* columnName(ImportColumn columnParm);
+
+    /**
+     * @brief Looks up a column by its name (lower case, as columnName() gives it).
+     */
+    static bool findColumn(std::string_view nameParm, ImportColumn& columnOutParm);
+
+private:
+    const char* pSliceCsv(std::string_view lineParm, std::string_view* fieldsParm) const;
+    const char* pSliceJson(std::string_view lineParm, std::string_view* fieldsParm) const;
+    static void pParseRange(const EmployeeImportParser* parserParm, std::vector<ImportChunk>* chunksParm,
+                            size_t firstParm, size_t strideParm);
+
+    RecordFormat mFormat;
+    std::vector<int> mCsvColumns;  // CSV cell position -> ImportColumn, or -1 if ignored
+};
+
+#endif // EMPLOYEE_IMPORT_H
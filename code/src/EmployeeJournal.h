@@ -0,0 +1,194 @@
+#ifndef EMPLOYEE_JOURNAL_H
+#define EMPLOYEE_JOURNAL_H
+
+#include "EmployeeFactory.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// JournalVersion is bumped whenever the entry encoding changes; older journals are rejected.
+enum JournalConstants {
+    JournalVersion = 1,
+    JournalRecordsPerEntry = 1 << 16,   // logAdd starts a new entry after this many records
+    JournalMaxNameBytes = UINT16_MAX    // JournalRecord::mNameBytes
+};
+
+/**
+ * One logged mutation. The payload of every entry starts with its op byte.
+ */
+enum JournalOp {
+    JournalAddEmployees = 1,   // uint32_t count, then count x (JournalRecord, name bytes)
+    JournalResign = 2,         // uint64_t id, int32_t date of leaving
+    JournalConvert = 3,        // JournalRecord, name bytes: the new full-time record
+    JournalAddLeaves = 4       // int32_t leaves added to every active full-time employee
+};
+
+/**
+ * @struct JournalHeader
+ * @brief First bytes of a journal file.
+ *
+ * File layout (native byte order):
+ *   JournalHeader
+ *   entries, each: uint32_t payload bytes, uint32_t CRC-32 of the payload, payload
+ * mGeneration names the snapshot the entries apply on top of: saving a
+ * snapshot stamps it with the next generation and restarts the journal there.
+ */
+struct JournalHeader {
+    char mMagic[8];             // "XYZJRNL\0"
+    uint32_t mVersion;
+    uint32_t mReserved;
+    uint64_t mGeneration;
+};
+
+/**
+ * @struct JournalRecord
+ * @brief Fixed part of one logged employee; the name text follows it. Genders are stored as Gender values.
+ */
+struct JournalRecord {
+    enum JournalRecordFlags { KeepDetails = 1 };
+
+    uint64_t mId;        // EmployeeId::raw()
+    int32_t mDob;        // CivilDate::dayNumber()
+    int32_t mDoj;
+    int32_t mDol;
+    int32_t mLeaves;
+    uint16_t mNameBytes;
+    uint8_t mGender;
+    uint8_t mType;
+    uint8_t mStatus;
+    uint8_t mFlags;
+    uint8_t mAgency;
+    uint8_t mCollege;
+    uint8_t mBranch;
+    uint8_t mPadding[7];
+};
+
+static_assert(sizeof(JournalHeader) == 24, "journal header layout changed");
+static_assert(sizeof(JournalRecord) == 40, "journal record layout changed");
+
+/**
+ * @struct JournalEntry
+ * @brief A decoded entry. Only the fields of mOp are meaningful.
+ */
+struct JournalEntry {
+    JournalOp mOp = JournalAddEmployees;
+    std::vector<NewEmployeeArgs> mArgs;   // JournalAddEmployees, JournalConvert (one element)
+    EmployeeId mId;                       // JournalResign
+    CivilDate mDol;                       // JournalResign
+    int mLeaves = 0;                      // JournalAddLeaves
+};
+
+/**
+ * @class JournalReader
+ * @brief Read-only memory mapping of a journal, decoded one entry at a time.
+ *
+ * next() stops at the end of the file or at the first entry that is cut
+ * short or fails its checksum, which is what a crash in the middle of an
+ * append leaves behind; validBytes() is then the length of the intact prefix.
+ */
+class JournalReader {
+public:
+    JournalReader();
+    ~JournalReader();
+
+    JournalReader(const JournalReader&) = delete;
+    JournalReader& operator=(const JournalReader&) = delete;
+
+    /**
+     * @return false with errorOutParm set if the file cannot be mapped or is not a journal.
+     */
+    bool open(const std::string& pathParm, std::string& errorOutParm);
+
+    const JournalHeader& header() const { return *reinterpret_cast<const JournalHeader*>(mData); }
+
+    /**
+     * @brief Decodes the next entry; names are interned as they are read.
+     * @return false at the end of the intact prefix.
+     */
+    bool next(JournalEntry& entryOutParm);
+
+    uint64_t validBytes() const { return mOffset; }
+    bool atEnd() const { return mOffset == mSize; }
+
+private:
+    void pClose();
+
+    const char* mData;
+    size_t mSize;
+    size_t mOffset;
+};
+
+/**
+ * @class EmployeeJournal
+ * @brief Append-only mutation log with group commit.
+ *
+ * Entries are encoded into a buffer that is written out once it holds 64 KB
+ * and at every commit(), so a committed operation survives a crash of the
+ * process. Every syncInterval commits the file is also fdatasync'ed, which
+ * makes it survive a crash of the machine; 0 leaves syncing to the OS. A
+ * bulk operation logs many records but commits once. Recovery works entry by
+ * entry, so a crash while a bulk addition of more than JournalRecordsPerEntry
+ * employees is written out can leave only its first entries to replay. A
+ * name longer than JournalMaxNameBytes cannot be logged; it fails the
+ * journal like a write error instead of being cut short. Not thread-safe.
+ */
+class EmployeeJournal {
+public:
+    EmployeeJournal();
+    ~EmployeeJournal();
+
+    EmployeeJournal(const EmployeeJournal&) = delete;
+    EmployeeJournal& operator=(const EmployeeJournal&) = delete;
+
+    /**
+     * @brief Opens pathParm for appending after its first validBytesParm bytes, dropping the rest.
+     *
+     * A validBytesParm of 0 (or a missing file) starts a new, empty journal for generationParm.
+     */
+    bool open(const std::string& pathParm, uint64_t generationParm, uint64_t validBytesParm);
+    bool isOpen() const { return mFd >= 0; }
+
+    void setSyncInterval(unsigned intervalParm) { mSyncInterval = intervalParm; }
+
+    // Each log call appends one entry, logAdd one per JournalRecordsPerEntry records;
+    // they do nothing while the journal is closed.
+    void logAdd(const NewEmployeeArgs* argsParm, size_t countParm);
+    void logResign(EmployeeId idParm, CivilDate dolParm);
+    void logConvert(const NewEmployeeArgs& argsParm);
+    void logAddLeaves(int leavesParm);
+
+    /**
+     * @brief Ends one operation: writes out the buffer and syncs if the interval is reached.
+     * @return false if a write or sync failed; see error().
+     */
+    bool commit();
+
+    /**
+     * @brief Empties the journal and restarts it at generationParm, after a snapshot took over its entries.
+     */
+    bool reset(uint64_t generationParm);
+
+    const std::string& error() const { return mError; }
+
+private:
+    enum EmployeeJournalConstants { BufferBytes = 1 << 16 };
+
+    void pBeginEntry(JournalOp opParm);
+    void pEndEntry();
+    void pPutRecord(const NewEmployeeArgs& argsParm);
+    void pPut(const void* dataParm, size_t bytesParm);
+    bool pWriteHeader(uint64_t generationParm);
+    void pFlush();
+    void pFail(const std::string& whatParm);
+
+    int mFd;
+    std::string mPath;
+    std::vector<char> mBuffer;
+    size_t mEntryStart;
+    unsigned mSyncInterval;
+    unsigned mUnsynced;
+    std::string mError;
+};
+
+#endif // EMPLOYEE_JOURNAL_H
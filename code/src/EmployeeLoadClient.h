@@ -0,0 +1,50 @@
+#ifndef EMPLOYEE_LOAD_CLIENT_H
+#define EMPLOYEE_LOAD_CLIENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum LoadTestDefaults {
+    DefaultLoadRequests = 100000,
+    DefaultLoadConnections = 4,
+    DefaultLoadDepth = 16,
+    LoadSampleIds = 10000
+};
+
+/**
+ * @class EmployeeLoadClient
+ * @brief Drives a running EmployeeServer with ID lookups and reports their latency.
+ *
+ * The client first asks the server for up to LoadSampleIds employees
+ * ("summary limit=N") and then spreads the requested number of "find-id"
+ * lookups for those IDs over the given connections, one thread each.
+ * Every connection keeps up to depth requests in flight (pipelining);
+ * a request's latency runs from just before it is written until its
+ * reply has been read. The report gives the throughput and the p50, p90,
+ * p99, p99.9 and maximum latency.
+ */
+class EmployeeLoadClient {
+public:
+    EmployeeLoadClient(const std::string& pathParm, size_t requestsParm, size_t connectionsParm, size_t depthParm);
+
+    /**
+     * @brief Runs the test and prints the report.
+     * @return false with errorOutParm set if the server cannot be reached or a reply is malformed.
+     */
+    bool run(std::string& errorOutParm);
+
+private:
+    bool pConnect(int& fdOutParm, std::string& errorOutParm) const;
+    bool pSampleIds(std::vector<std::string>& idsOutParm, std::string& errorOutParm) const;
+    bool pDrive(size_t firstParm, size_t countParm, const std::vector<std::string>& idsParm,
+                std::vector<uint64_t>& latenciesOutParm, size_t& missesOutParm, std::string& errorOutParm) const;
+
+    std::string mPath;
+    size_t mRequests;
+    size_t mConnections;
+    size_t mDepth;
+};
+
+#endif // EMPLOYEE_LOAD_CLIENT_H
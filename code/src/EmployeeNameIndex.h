@@ -0,0 +1,63 @@
+#ifndef EMPLOYEE_NAME_INDEX_H
+#define EMPLOYEE_NAME_INDEX_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "EmployeeId.h"
+
+/**
+ * @class EmployeeNameIndex
+ * @brief Trie over normalized (trimmed, lower-cased) employee names.
+ *
+ * Every terminal node holds the IDs of the employees with that name, in
+ * insertion order; callers resolve them through the ID index. Exact and
+ * prefix lookups walk the query once and then only visit the matching
+ * subtree, stopping as soon as the result limit is reached.
+ */
+class EmployeeNameIndex {
+public:
+    EmployeeNameIndex();
+
+    /**
+     * @brief Normalizes a name the way the index stores it (trim + lower-case).
+     */
+    static std::string normalize(const std::string& nameParm);
+
+    void insert(const std::string& nameParm, EmployeeId idParm);
+    bool erase(const std::string& nameParm, EmployeeId idParm);
+    void clear();
+
+    /**
+     * @brief Appends IDs whose normalized name equals the normalized query.
+     * @return Number of IDs appended (at most limitParm).
+     */
+    size_t findExact(const std::string& nameParm, size_t limitParm,
+                     std::vector<EmployeeId>& idsOutParm) const;
+
+    /**
+     * @brief Appends IDs whose normalized name starts with the normalized prefix,
+     *        in lexicographic name order.
+     * @return Number of IDs appended (at most limitParm).
+     */
+    size_t findPrefix(const std::string& prefixParm, size_t limitParm,
+                      std::vector<EmployeeId>& idsOutParm) const;
+
+private:
+    struct TrieNode {
+        std::vector<std::pair<char, uint32_t> > mChildren;   // sorted by character
+        std::vector<EmployeeId> mIds;                       // employees whose name ends here
+    };
+
+    enum NameIndexConstants { RootNode = 0, NoNode = 0xFFFFFFFFu };
+
+    uint32_t pChild(uint32_t nodeParm, char chParm) const;
+    uint32_t pDescend(const std::string& keyParm) const;
+    void pCollect(uint32_t nodeParm, size_t limitParm, std::vector<EmployeeId>& idsOutParm,
+                  size_t& countParm) const;
+
+    std::vector<TrieNode> mNodes;
+};
+
+#endif // EMPLOYEE_NAME_INDEX_H
@@ -0,0 +1,84 @@
+#ifndef EMPLOYEE_PROTOCOL_H
+#define EMPLOYEE_PROTOCOL_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * Framing of the server protocol (see EmployeeServer). Every request and
+ * every response is one frame:
+ *   uint32_t payload bytes, uint32_t tag (both big-endian), payload
+ * A request's payload is one command line as EmployeeCommandInterpreter
+ * reads it; the response's payload is that command's reply and carries the
+ * request's tag. Clients may send many requests before reading any reply;
+ * replies can arrive in any order, so the tag is what pairs them up.
+ * A client that keeps sending without reading is throttled: the server stops
+ * reading a connection that has MaxRequestsInFlight requests unanswered or
+ * MaxPendingOutput reply bytes unsent, until it falls back under both.
+ */
+enum ProtocolConstants {
+    FrameHeaderBytes = 8,
+    MaxFramePayload = 1 << 24,
+    MaxRequestsInFlight = 1024,
+    MaxPendingOutput = 1 << 24
+};
+
+/**
+ * @struct FrameHeader
+ * @brief Decoded frame header.
+ */
+struct FrameHeader {
+    uint32_t mBytes = 0;
+    uint32_t mTag = 0;
+};
+
+/**
+ * @class EmployeeProtocol
+ * @brief Encodes and decodes frames.
+ */
+class EmployeeProtocol {
+public:
+    static void putUint32(char* outParm, uint32_t valueParm)
+    {
+        outParm[0] = static_cast<char>(valueParm >> 24);
+        outParm[1] = static_cast<char>(valueParm >> 16);
+        outParm[2] = static_cast<char>(valueParm >> 8);
+        outParm[3] = static_cast<char>(valueParm);
+    }
+
+    static uint32_t getUint32(const char* dataParm)
+    {
+        const unsigned char* sBytes = reinterpret_cast<const unsigned char*>(dataParm);
+        return (uint32_t(sBytes[0]) << 24) | (uint32_t(sBytes[1]) << 16) | (uint32_t(sBytes[2]) << 8) | sBytes[3];
+    }
+
+    /**
+     * @brief Appends one frame carrying payloadParm to outParm.
+     */
+    static void appendFrame(uint32_t tagParm, std::string_view payloadParm, std::string& outParm)
+    {
+        char sHeader[FrameHeaderBytes];
+        putUint32(sHeader, static_cast<uint32_t>(payloadParm.size()));
+        putUint32(sHeader + 4, tagParm);
+        outParm.append(sHeader, sizeof(sHeader));
+        outParm.append(payloadParm);
+    }
+
+    /**
+     * @brief Decodes the frame at the start of dataParm if all of it has arrived.
+     * @return Bytes the whole frame takes, or 0 if it is still incomplete (or, if
+     *         headerOutParm.mBytes exceeds MaxFramePayload, can never be accepted).
+     */
+    static size_t peekFrame(std::string_view dataParm, FrameHeader& headerOutParm)
+    {
+        if (dataParm.size() < FrameHeaderBytes) return 0;
+        headerOutParm.mBytes = getUint32(dataParm.data());
+        headerOutParm.mTag = getUint32(dataParm.data() + 4);
+        size_t sTotal = FrameHeaderBytes + static_cast<size_t>(headerOutParm.mBytes);
+        return (headerOutParm.mBytes <= MaxFramePayload && dataParm.size() >= sTotal) ? sTotal : 0;
+    }
+};
+
+#endif // EMPLOYEE_PROTOCOL_H
@@ -0,0 +1,55 @@
+#ifndef EMPLOYEE_ROW_HANDLE_H
+#define EMPLOYEE_ROW_HANDLE_H
+
+#include "XyzEmployeeIF.h"
+#include <string>
+#include <cstdint>
+
+class EmployeeColumnStore;
+
+/**
+ * @class EmployeeRowHandle
+ * @brief Thin XyzEmployeeIF view of one row of an EmployeeColumnStore.
+ *
+ * Holds only the store pointer and the row number; every getter reads the
+ * store's columns. Summaries and detail printouts match the per-type employee
+ * classes, so the UI cannot tell the two storage engines apart.
+ */
+class EmployeeRowHandle : public XyzEmployeeIF {
+public:
+    EmployeeRowHandle(EmployeeColumnStore* storeParm, uint32_t rowParm)
+        : mStore(storeParm), mRow(rowParm) {}
+
+    uint32_t row() const { return mRow; }
+
+    std::string getName() const override;
+    std::string getId() const override;
+    EmployeeId getEmployeeId() const override;
+    std::string getGender() const override;
+    Symbol getNameSymbol() const override;
+    Symbol getGenderSymbol() const override;
+    std::string_view getNameView() const override;
+    std::string_view getGenderView() const override;
+    std::string getDob() const override;
+    std::string getDoj() const override;
+    CivilDate getDobDate() const override;
+    CivilDate getDojDate() const override;
+
+    EmployeeType getType() const override;
+    EmployeeStatus getStatus() const override;
+    void setStatus(EmployeeStatus statusParm) override;
+    void setDol(CivilDate dolParm) override;
+
+    EmployeeSummary toSummary() const override;
+    void visitFields(EmployeeFieldVisitor& visitorParm) const override;
+    void printFullDetails() const override;
+    void toArgs(NewEmployeeArgs& argsOutParm) const override;
+
+    void addLeaves(int leavesParm) override;
+
+private:
+    EmployeeColumnStore* mStore;
+    uint32_t mRow;
+};
+
+#endif // EMPLOYEE_ROW_HANDLE_H
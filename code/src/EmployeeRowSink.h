@@ -0,0 +1,54 @@
+#ifndef EMPLOYEE_ROW_SINK_H
+#define EMPLOYEE_ROW_SINK_H
+
+#include "XyzEmployeeIF.h"
+#include <utility>
+
+/**
+ * @class EmployeeRowSink
+ * @brief Consumer end of a report pipeline: receives employee records one at a time.
+ *
+ * Sources (rosters, bitmap selections) push records in order; nothing is
+ * copied or collected, so a report holds one row at a time whatever the
+ * roster size.
+ */
+class EmployeeRowSink {
+public:
+    /**
+     * @brief Consumes one record.
+     * @return bool False asks the source to stop pushing.
+     */
+    virtual bool accept(const XyzEmployeeIF& employeeParm) = 0;
+    virtual ~EmployeeRowSink() {}
+};
+
+/**
+ * @class EmployeeFilterStage
+ * @brief Pipeline stage that forwards only the records the predicate accepts.
+ */
+template <typename PredicateT>
+class EmployeeFilterStage : public EmployeeRowSink {
+public:
+    EmployeeFilterStage(PredicateT predicateParm, EmployeeRowSink& nextParm)
+        : mPredicate(std::move(predicateParm)), mNext(nextParm) {}
+
+    bool accept(const XyzEmployeeIF& employeeParm) override
+    {
+        return mPredicate(employeeParm) ? mNext.accept(employeeParm) : true;
+    }
+
+private:
+    PredicateT mPredicate;
+    EmployeeRowSink& mNext;
+};
+
+/**
+ * @brief Builds a filter stage in front of nextParm (deduces the predicate type).
+ */
+template <typename PredicateT>
+EmployeeFilterStage<PredicateT> makeFilterStage(PredicateT predicateParm, EmployeeRowSink& nextParm)
+{
+    return EmployeeFilterStage<PredicateT>(std::move(predicateParm), nextParm);
+}
+
+#endif // EMPLOYEE_ROW_SINK_H
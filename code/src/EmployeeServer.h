@@ -0,0 +1,101 @@
+#ifndef EMPLOYEE_SERVER_H
+#define EMPLOYEE_SERVER_H
+
+#include "EmployeeProtocol.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class XyzEmployeeManager;
+
+/**
+ * @class EmployeeServer
+ * @brief Serves command requests for one resident roster over a Unix domain socket.
+ *
+ * One I/O thread accepts connections and reads request frames (see
+ * EmployeeProtocol.h) from all of them with poll(); each complete request
+ * goes on a queue served by a fixed pool of worker threads, each running
+ * its own EmployeeCommandInterpreter. A connection may have up to
+ * MaxRequestsInFlight requests in flight; replies are sent as soon as they
+ * are ready, tagged with their request's tag. A worker sends its reply
+ * itself when nothing is queued ahead of it on the connection and hands the
+ * rest to the I/O thread otherwise. A connection at either limit of
+ * EmployeeProtocol.h, or holding a whole frame it cannot queue yet, is not
+ * read from until it drains, so its buffers stay bounded. Workers call the
+ * manager concurrently; it does its own locking, so lookups run in
+ * parallel. run() returns after SIGINT or SIGTERM.
+ */
+class EmployeeServer {
+public:
+    EmployeeServer(XyzEmployeeManager& managerParm, const std::string& pathParm, size_t workersParm);
+    ~EmployeeServer();
+
+    EmployeeServer(const EmployeeServer&) = delete;
+    EmployeeServer& operator=(const EmployeeServer&) = delete;
+
+    /**
+     * @brief Binds the socket (replacing a stale one, but not one a live server answers on) and serves until stopped.
+     * @return false with error() set if the socket cannot be set up.
+     */
+    bool run();
+
+    const std::string& error() const { return mError; }
+
+private:
+    /**
+     * One client. The I/O thread owns mFd's reading side and mInput; mOutput
+     * holds reply bytes not yet sent and is shared with the workers.
+     */
+    struct Connection {
+        int mFd = -1;
+        std::string mInput;
+        std::mutex mMutex;
+        std::string mOutput;           // guarded by mMutex
+        std::atomic<size_t> mInFlight{0};
+        std::atomic<bool> mReadClosed{false};   // peer finished sending; close once the replies are out
+        bool mBroken = false;          // guarded by mMutex: a send failed, drop the connection
+
+        ~Connection();
+    };
+
+    struct Job {
+        std::shared_ptr<Connection> mConnection;
+        uint32_t mTag;
+        std::string mRequest;
+    };
+
+    bool pListen();
+    void pServe();
+    void pWork();
+    bool pReadRequests(Connection& connectionParm);
+    bool pQueueRequests(const std::shared_ptr<Connection>& connectionParm);
+    static bool pMayRead(Connection& connectionParm);
+    void pSendReply(Connection& connectionParm, const std::string& frameParm);
+    bool pFlushOutput(Connection& connectionParm);
+    void pWake();
+    void pStop();
+
+    XyzEmployeeManager& mManager;
+    std::string mPath;
+    size_t mWorkers;
+    int mListenFd;
+    int mWakePipe[2];
+    std::vector<std::shared_ptr<Connection> > mConnections;   // I/O thread only
+
+    std::mutex mQueueMutex;
+    std::condition_variable mQueueReady;
+    std::deque<Job> mQueue;            // guarded by mQueueMutex
+    bool mStopping;                    // guarded by mQueueMutex
+    std::vector<std::thread> mThreads;
+
+    std::string mError;
+};
+
+#endif // EMPLOYEE_SERVER_H
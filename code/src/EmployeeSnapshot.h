@@ -0,0 +1,178 @@
+#ifndef EMPLOYEE_SNAPSHOT_H
+#define EMPLOYEE_SNAPSHOT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Bumped whenever the file layout changes; older files are rejected.
+enum SnapshotConstants {
+    SnapshotVersion = 2
+};
+
+/**
+ * @struct SnapshotHeader
+ * @brief First bytes of a snapshot file.
+ *
+ * File layout (native byte order, every section starts on an 8-byte boundary):
+ *   SnapshotHeader
+ *   SnapshotRecord[mRecordCount]     one per row, in row order
+ *   uint32_t[mActiveCount]           active/inactive roster, as row numbers
+ *   uint32_t[mResignedCount]         resigned roster, as row numbers
+ *   uint64_t[mSymbolCount + 1]       offset of each symbol's text, then the end
+ *   char[mSymbolBytes]               symbol text, not NUL-terminated
+ * Section offsets follow from the counts (see SnapshotLayout), so a reader can
+ * check the file size before touching any section.
+ */
+struct SnapshotHeader {
+    char mMagic[8];             // "XYZSNAP\0"
+    uint32_t mVersion;
+    uint32_t mRecordBytes;      // sizeof(SnapshotRecord) of the writer
+    uint64_t mEmployeeCounter;
+    uint64_t mRecordCount;
+    uint64_t mActiveCount;
+    uint64_t mResignedCount;
+    uint64_t mSymbolCount;
+    uint64_t mSymbolBytes;
+    uint64_t mGeneration;       // journal generation that continues from this snapshot
+};
+
+/**
+ * @struct SnapshotRecord
+ * @brief One employee, fixed size. Names and genders are indexes into the file's symbol section.
+ */
+struct SnapshotRecord {
+    enum SnapshotRecordFlags { KeepDetails = 1 };
+
+    uint64_t mId;        // EmployeeId::raw()
+    uint32_t mName;
+    uint32_t mGender;
+    int32_t mDob;        // CivilDate::dayNumber()
+    int32_t mDoj;
+    int32_t mDol;
+    int32_t mLeaves;
+    uint8_t mType;
+    uint8_t mStatus;
+    uint8_t mFlags;
+    uint8_t mAgency;
+    uint8_t mCollege;
+    uint8_t mBranch;
+    uint8_t mPadding[2];
+};
+
+static_assert(sizeof(SnapshotHeader) == 72, "snapshot header layout changed");
+static_assert(sizeof(SnapshotRecord) == 40, "snapshot record layout changed");
+
+/**
+ * @struct SnapshotLayout
+ * @brief Byte offsets of each section, computed from the header's counts.
+ */
+struct SnapshotLayout {
+    uint64_t mRecords;
+    uint64_t mActiveRows;
+    uint64_t mResignedRows;
+    uint64_t mSymbolOffsets;
+    uint64_t mSymbolText;
+    uint64_t mTotalBytes;
+
+    static SnapshotLayout of(const SnapshotHeader& headerParm);
+};
+
+/**
+ * @class SnapshotWriter
+ * @brief Streams a snapshot to disk through one fixed buffer.
+ *
+ * Output goes to "<path>.tmp", which commit() renames over the real path, so
+ * an interrupted save never replaces a good snapshot. Memory use does not grow
+ * with the roster size.
+ */
+class SnapshotWriter {
+public:
+    SnapshotWriter();
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    bool open(const std::string& pathParm);
+    void append(const void* dataParm, size_t bytesParm);
+
+    /**
+     * @brief Writes zero bytes up to the next 8-byte boundary.
+     */
+    void alignSection();
+
+    /**
+     * @brief Flushes, syncs and renames the file into place.
+     * @return false if any write failed; the temporary file is removed.
+     */
+    bool commit();
+
+    const std::string& error() const { return mError; }
+
+    static void fillMagic(SnapshotHeader& headerParm);
+
+private:
+    enum SnapshotWriterConstants { BufferBytes = 1 << 16 };
+
+    void pFlush();
+    void pFail(const std::string& whatParm);
+
+    int mFd;
+    std::string mPath;
+    std::string mTempPath;
+    std::vector<char> mBuffer;
+    size_t mUsed;
+    uint64_t mWritten;
+    std::string mError;
+};
+
+/**
+ * @class SnapshotFile
+ * @brief Read-only memory mapping of a snapshot.
+ *
+ * open() maps the file and checks the header and section sizes; nothing else
+ * is read until the caller walks the sections, so pages are faulted in only
+ * as records are materialized.
+ */
+class SnapshotFile {
+public:
+    SnapshotFile();
+    ~SnapshotFile();
+
+    SnapshotFile(const SnapshotFile&) = delete;
+    SnapshotFile& operator=(const SnapshotFile&) = delete;
+
+    /**
+     * @return false with errorOutParm set if the file cannot be mapped or is not a valid snapshot.
+     */
+    bool open(const std::string& pathParm, std::string& errorOutParm);
+
+    const SnapshotHeader& header() const { return *reinterpret_cast<const SnapshotHeader*>(mData); }
+    const SnapshotRecord* records() const { return pAt<SnapshotRecord>(mLayout.mRecords); }
+    const uint32_t* activeRows() const { return pAt<uint32_t>(mLayout.mActiveRows); }
+    const uint32_t* resignedRows() const { return pAt<uint32_t>(mLayout.mResignedRows); }
+
+    /**
+     * @brief Text of symbol indexParm; indexParm must be < header().mSymbolCount.
+     */
+    std::string_view symbol(uint64_t indexParm) const;
+
+    /**
+     * @brief Checks that the symbol offsets are increasing and inside the text section.
+     */
+    bool symbolsValid() const;
+
+private:
+    template <typename T>
+    const T* pAt(uint64_t offsetParm) const { return reinterpret_cast<const T*>(mData + offsetParm); }
+    void pClose();
+
+    const char* mData;
+    size_t mSize;
+    SnapshotLayout mLayout;
+};
+
+#endif // EMPLOYEE_SNAPSHOT_H
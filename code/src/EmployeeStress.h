@@ -0,0 +1,70 @@
+#ifndef EMPLOYEE_STRESS_H
+#define EMPLOYEE_STRESS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class XyzEmployeeManager;
+
+enum StressDefaults {
+    DefaultStressOperations = 50000,   // per thread in a stress run, in all for each benchmark point
+    StressRosterSize = 100000,         // employees generated first when the roster is empty
+    StressSampleIds = 100000,
+    MaxBenchThreads = 16
+};
+
+/**
+ * @class EmployeeStressTest
+ * @brief Hammers one manager from many threads through its public operations.
+ *
+ * Threads draw operations on IDs sampled from the roster: lookups by ID,
+ * name-prefix searches and bitmap counts, mixed with additions,
+ * resignations and conversions to full-time (and, in stress runs, the odd
+ * add-leaves). stress() then checks that no lookup of a sampled ID failed,
+ * that the head counts moved by exactly the successful writes and that the
+ * manager's indexes agree with its records (XyzEmployeeManager::checkIndexes).
+ * benchmark() times a read-only and a read-mostly workload at 1, 2, 4, 8
+ * and 16 threads and prints the throughput of each.
+ */
+class EmployeeStressTest {
+public:
+    explicit EmployeeStressTest(XyzEmployeeManager& managerParm);
+
+    /**
+     * @brief Runs operationsParm operations on each of threadsParm threads and verifies the result.
+     * @return false with errorOutParm set if a check fails.
+     */
+    bool stress(size_t threadsParm, size_t operationsParm, std::string& errorOutParm);
+
+    /**
+     * @brief Prints throughput at 1 to MaxBenchThreads threads, operationsParm operations per point.
+     */
+    void benchmark(size_t operationsParm);
+
+private:
+    enum Workload { ReadWorkload, MixedWorkload, StressWorkload };
+
+    /**
+     * What one thread did; successful writes only.
+     */
+    struct Tally {
+        size_t mReads = 0;
+        size_t mLostIds = 0;
+        size_t mAdds = 0;
+        size_t mResigns = 0;
+        size_t mConverts = 0;
+        size_t mLeaveRounds = 0;
+    };
+
+    void pPrepare();
+    double pRun(Workload workloadParm, size_t threadsParm, size_t operationsParm, std::vector<Tally>& talliesOutParm);
+    void pWork(Workload workloadParm, uint64_t seedParm, size_t operationsParm, Tally& tallyParm);
+
+    XyzEmployeeManager& mManager;
+    std::vector<std::string> mIds;
+    uint64_t mRuns;
+};
+
+#endif // EMPLOYEE_STRESS_H
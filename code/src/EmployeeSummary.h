@@ -1,21 +1,25 @@
 #pragma once
-#include <string>
 #include <optional>
+#include "SymbolTable.h"
+#include "EmployeeId.h"
+#include "CivilDate.h"
 
+// Text fields are interned symbols and the ID and dates stay in their compact
+// forms; PrintService formats them when the row is rendered.
 struct EmployeeSummary {
-    std::string name;
-    std::string id;
-    std::string gender;
-    std::string type;
-    std::string status;
-    std::string dob;
-    std::string doj;
-    std::string dol; 
+    Symbol name;
+    EmployeeId id;
+    Symbol gender;
+    Symbol type;
+    Symbol status;
+    CivilDate dob;
+    CivilDate doj;
+    CivilDate dol;     // none prints as "-"
 
     std::optional<int> totalLeaves;
     std::optional<int> availedLeaves;
 
-    std::optional<std::string> agency;
-    std::optional<std::string> college;
-    std::optional<std::string> branch;
-};
\ No newline at end of file
+    std::optional<Symbol> agency;
+    std::optional<Symbol> college;
+    std::optional<Symbol> branch;
+};
@@ -21,6 +21,12 @@ enum EmployeeStatus {
     Resigned
 };
 
+// Represents the gender of an employee.
+enum Gender {
+    Male,
+    Female
+};
+
 // Represents the external agencies for contractor employees.
 enum Agency {
     Avengers,
@@ -47,6 +53,30 @@ enum Branch {
     ECE
 };
 
+// Represents the displayable fields of an employee, in summary-table column order
+enum EmployeeField {
+    FieldName,
+    FieldId,
+    FieldGender,
+    FieldType,
+    FieldStatus,
+    FieldDob,
+    FieldDoj,
+    FieldDol,
+    FieldTotalLeaves,
+    FieldAvailedLeaves,
+    FieldAgency,
+    FieldCollege,
+    FieldBranch,
+    MaxEmployeeFields
+};
+
+// Represents the storage engine backing the employee records
+enum StorageEngine {
+    ObjectStorage,    // one heap object per employee
+    ColumnarStorage   // EmployeeColumnStore rows behind thin handles
+};
+
 // Represents menu options for the main menu
 enum MainMenuOptions {
     AddEmployee = 1,
@@ -75,6 +105,8 @@ enum SpecificEmployeeMenuOptions {
 enum SearchMenuOptions {
     SearchById = 1,
     SearchByName,
+    SearchByNameIgnoreCase,
+    SearchByNamePrefix,
     BackToMainMenuFromSearch = -1 
 };
 
@@ -85,9 +117,19 @@ enum DetailsMenuOptions {
     SummaryByGender,
     SummaryByStatus,
     DisplayDetailsById,
+    SummaryByFilters,
     BackToMainMenuFromDetails = -1
 };
 
+// Represents menu options for paging through a report
+enum BrowseMenuOptions {
+    BrowseNextPage = 1,
+    BrowsePreviousPage,
+    BrowseJumpToId,
+    BrowseMenuCount = 3,
+    BackToDetailsMenu = -1
+};
+
 // Represents menu options for the other operations menu
 enum OperationsMenuOptions {
     AddLeavesToFullTime = 1,
@@ -95,6 +137,8 @@ enum OperationsMenuOptions {
     ConvertContractorToFullTime,
     SearchEmployeeById,
     SearchEmployeeByName,
+    SearchEmployeeByNameIgnoreCase,
+    SearchEmployeeByNamePrefix,
     BackToMainMenuFromOperations = -1
 };
 
@@ -122,6 +166,14 @@ enum StatusSubmenu
   StatusSubmenuCount = 3
 };
 
+// "Any" entry appended to each submenu of the combined-filter summary
+enum FilterSubmenu
+{
+  FilterAnyType = TypeSubmenuCount + 1,
+  FilterAnyGender = GenderSubmenuCount + 1,
+  FilterAnyStatus = StatusSubmenuCount + 1
+};
+
 // Represents array sizes and limits
 enum ArrayLimits {
     MaxNamesInPool = 5,
@@ -130,12 +182,73 @@ enum ArrayLimits {
     MaxBranches = 3,
     MaxEmployeeTypes = 3,
     MaxEmployeeStatuses = 3,
+    MaxGenders = 2,
     MaxMenuOptions = 5,
     MaxMainMenuOptions = 5, 
     MaxAddMenuOptions = 2,
-    MaxSearchMenuOptions = 2,
-    MaxDetailsMenuOptions = 5,
-    MaxOperationsMenuOptions = 5 
+    MaxSearchMenuOptions = 4,
+    MaxDetailsMenuOptions = 6,
+    MaxOperationsMenuOptions = 7 
+};
+
+// Represents result limits for index-backed searches
+enum SearchLimits {
+    DefaultNameSearchLimit = 50
+};
+
+// Represents how bulk random generation is split into independently seeded batches
+enum BulkGenerationLimits {
+    RandomBatchSize = 4096,
+    MaxBulkRandom = 1 << 22        // most employees one request may generate
+};
+
+// Represents the text formats accepted for bulk import and written by bulk export
+enum RecordFormat {
+    CsvFormat,
+    NdjsonFormat
+};
+
+// Represents how a bulk import is cut into chunks that are parsed in parallel
+enum ImportLimits {
+    ImportChunkBytes = 1 << 22,
+    MaxImportNameLength = 256
+};
+
+// Represents which rosters a bulk export covers
+enum ExportRosters {
+    ExportCurrent = 1,
+    ExportResigned = 2,
+    ExportAllRosters = ExportCurrent | ExportResigned
+};
+
+// Represents the output buffer of a bulk export
+enum ExportLimits {
+    ExportBufferBytes = 1 << 20
+};
+
+// Represents the outcome of a manager operation that does not print its own messages
+enum OperationResult {
+    OperationOk,
+    OperationBadArgument,   // malformed ID, count or field
+    OperationNotFound,      // no such employee
+    OperationNotAllowed     // the employee exists but the operation does not apply to it
+};
+
+// Represents the input and output buffers of a command stream
+enum CommandLimits {
+    CommandBufferBytes = 1 << 20,
+    MaxCommandArguments = 8
+};
+
+// Represents the rows shown per page when browsing a report
+enum ReportLimits {
+    DefaultReportPageSize = 20
+};
+
+// Represents the two passes of a report: current employees, then resigned ones
+enum CursorPhase {
+    CursorCurrentRows,
+    CursorResignedRows
 };
 
 // Represents date-related constants
@@ -146,9 +259,12 @@ enum DateConstants {
     MaxMonth = 12,
     MinDay = 1,
     MaxDay = 28,
+    MinValidYear = 1900,
+    MaxValidYear = 3000,
     ContractorContractYears = 1,
     InternContractMonths = 6,
-    DefaultLeavesForConversion = 10
+    DefaultLeavesForConversion = 10,
+    MinJoiningAge = 18
 };
 
 // Represents leave policy constants
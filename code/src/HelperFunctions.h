@@ -2,7 +2,11 @@
 #define HELPER_FUNCTIONS_H
 
 #include "Enums.h"
+#include "CivilDate.h"
+#include "SymbolTable.h"
+#include "RandomEngine.h"
 #include <string>
+#include <string_view>
 
 /**
  * @class HelperFunctions
@@ -12,25 +16,22 @@ class HelperFunctions
 {
 public:
   // Random data helpers
-  static std::string getRandomName(std::string genderParm);
-  static std::string getRandomGender();
-  static std::string getRandomDate();
-  static EmployeeStatus getRandomStatus();
-  static EmployeeType getRandomType();
+  static Symbol getRandomName(RandomEngine& randomParm, Gender genderParm);
+  static Gender getRandomGender(RandomEngine& randomParm);
+  static CivilDate getRandomDate(RandomEngine& randomParm);
+  static EmployeeStatus getRandomStatus(RandomEngine& randomParm);
+  static EmployeeType getRandomType(RandomEngine& randomParm);
+  static int getRandomInt(RandomEngine& randomParm, int boundParm);
 
   // User input helpers
   static int getMenuChoice(int minOptionParm, int maxOptionParm, int backCodeParm);
   static void clearInputBuffer();
-  static std::string getCurrentDate();
+  static CivilDate getCurrentDate();
 
   // Date helpers
-  static void parseDate(const std::string &dateParm, int &d, int &m, int &y);
-  static std::string makeDate(int d, int m, int y);
-  static std::string addMonths(const std::string &dateParm, int monthsToAdd);
-  static std::string addYears(const std::string &dateParm, int yearsToAdd);
-  static std::string getRandomDOB();
-  static std::string getRandomDOJFromDOB(const std::string &dobParm);
-  static std::string computeDateOfLeaving(EmployeeType typeParm, const std::string &dojParm);
+  static CivilDate getRandomDOB(RandomEngine& randomParm);
+  static CivilDate getRandomDOJFromDOB(RandomEngine& randomParm, CivilDate dobParm);
+  static CivilDate computeDateOfLeaving(RandomEngine& randomParm, EmployeeType typeParm, CivilDate dojParm);
 
   // Conversions
   static std::string convertTypeToString(EmployeeType typeParm);
@@ -38,6 +39,17 @@ public:
   static std::string convertAgencyToString(Agency agencyParm);
   static std::string convertCollegeToString(College collegeParm);
   static std::string convertBranchToString(Branch branchParm);
+  static std::string convertGenderToString(Gender genderParm);
+  static Gender convertStringToGender(std::string_view genderParm);
+
+  // Interned labels (same text as the convert*ToString functions)
+  static Symbol typeSymbol(EmployeeType typeParm);
+  static Symbol statusSymbol(EmployeeStatus statusParm);
+  static Symbol genderSymbol(Gender genderParm);
+  static Symbol agencySymbol(Agency agencyParm);
+  static Symbol collegeSymbol(College collegeParm);
+  static Symbol branchSymbol(Branch branchParm);
+  static void internLabels();
 
   // String helpers
   static std::string trim(const std::string& sParm);
@@ -49,7 +61,16 @@ public:
   // Validation helpers
   static bool isValidDateString(const std::string& sParm);
   static std::string normalizeGender(const std::string& sParm);
-  static bool isAtLeastYearsApart(const std::string &fromDateParm, const std::string &toDateParm, int yearsParm);
+  static bool isAtLeastYearsApart(CivilDate fromDateParm, CivilDate toDateParm, int yearsParm);
+
+  // Allocation-free field parsers for bulk import (ASCII case-insensitive)
+  static std::string_view trimView(std::string_view textParm);
+  static bool parseGender(std::string_view textParm, Gender& genderOutParm);
+  static bool parseType(std::string_view textParm, EmployeeType& typeOutParm);
+  static bool parseStatus(std::string_view textParm, EmployeeStatus& statusOutParm);
+  static bool parseAgency(std::string_view textParm, Agency& agencyOutParm);
+  static bool parseCollege(std::string_view textParm, College& collegeOutParm);
+  static bool parseBranch(std::string_view textParm, Branch& branchOutParm);
 };
 
 #endif // HELPER_FUNCTIONS_H
@@ -2,9 +2,14 @@
 #define PRINT_SERVICE_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <ostream>
 #include "EmployeeSummary.h"
+#include "XyzEmployeeIF.h"
+#include "EmployeeRowSink.h"
+#include "EmployeeFieldVisitor.h"
+#include "TableRenderer.h"
 #include "Enums.h"
 
 /**
@@ -19,11 +24,12 @@ public:
     static void printBlankLine();
 
     // Messages
+    static void sendMessagesToStderr();
     static void printInfo(const std::string& messageParm);
     static void printError(const std::string& messageParm);
 
     // Key-Value
-    static void printKeyValue(const std::string& keyParm, const std::string& valueParm);
+    static void printKeyValue(const std::string& keyParm, std::string_view valueParm);
     static void printKeyValue(const std::string& keyParm, int valueParm);
     static void printKeyValue(const std::string& keyParm, long valueParm);
 
@@ -38,10 +44,33 @@ public:
     static void printEmployeeSummaryTable(const std::vector<EmployeeSummary>& rowsParm,
                                           const std::string& tableTitleParm);
 
+    /**
+     * @class EmployeeTableSink
+     * @brief Pipeline sink that renders each record as a summary-table row as it arrives.
+     *
+     * The first accepted row brings the caption and column headings, and
+     * finish() closes the table (or reports that it was empty). A sink that is
+     * neither fed nor finished prints nothing.
+     * Rows go through a TableRenderer, which writes whenever its buffer fills
+     * and once more from finish().
+     */
+    class EmployeeTableSink : public EmployeeRowSink {
+    public:
+        explicit EmployeeTableSink(const std::string& tableTitleParm);
+        bool accept(const XyzEmployeeIF& employeeParm) override;
+        void finish();
+        size_t rowCount() const { return mRowCount; }
+
+    private:
+        std::string mTitle;
+        TableRenderer mRenderer;
+        size_t mRowCount;
+        EmployeeRowCells mCells;
+    };
+
 private:
     enum PrintServiceConstants { DividerWidth = 64 };
     static std::string pRepeat(char chParm, std::size_t countParm);
-    static std::vector<std::string> pWrapToWidth(const std::string& textParm, std::size_t widthParm);
 };
 
 #endif // PRINT_SERVICE_H
\ No newline at end of file
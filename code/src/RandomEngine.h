@@ -0,0 +1,79 @@
+#ifndef RANDOM_ENGINE_H
+#define RANDOM_ENGINE_H
+
+#include <cstdint>
+
+/**
+ * @class RandomEngine
+ * @brief Small, fast, seedable pseudo-random generator (xoshiro256**).
+ *
+ * Replaces std::rand(): all state lives in the object, so each thread owns
+ * its own instance and nothing is shared. The same seed always produces the
+ * same sequence on every platform, which makes generated data reproducible.
+ * The seed is expanded into the 256-bit state with SplitMix64, as the
+ * xoshiro authors recommend. Satisfies UniformRandomBitGenerator.
+ */
+class RandomEngine {
+public:
+    typedef uint64_t result_type;
+
+    explicit RandomEngine(uint64_t seedParm = 0) { seed(seedParm); }
+
+    void seed(uint64_t seedParm)
+    {
+        uint64_t sMix = seedParm;
+        for (uint64_t& sWord : mState) sWord = pSplitMix(sMix);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()()
+    {
+        const uint64_t sResult = pRotl(mState[1] * 5, 7) * 9;
+        const uint64_t sShifted = mState[1] << 17;
+        mState[2] ^= mState[0];
+        mState[3] ^= mState[1];
+        mState[1] ^= mState[2];
+        mState[0] ^= mState[3];
+        mState[2] ^= sShifted;
+        mState[3] = pRotl(mState[3], 45);
+        return sResult;
+    }
+
+    /**
+     * @brief Uniform value in [0, boundParm) without modulo bias (Lemire's multiply-shift).
+     * @param boundParm Exclusive upper bound; must be > 0.
+     */
+    uint32_t below(uint32_t boundParm)
+    {
+        uint64_t sProduct = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * boundParm;
+        uint32_t sLow = static_cast<uint32_t>(sProduct);
+        if (sLow < boundParm) {
+            const uint32_t sThreshold = static_cast<uint32_t>(-boundParm) % boundParm;
+            while (sLow < sThreshold) {
+                sProduct = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * boundParm;
+                sLow = static_cast<uint32_t>(sProduct);
+            }
+        }
+        return static_cast<uint32_t>(sProduct >> 32);
+    }
+
+private:
+    static uint64_t pRotl(uint64_t valueParm, int shiftParm)
+    {
+        return (valueParm << shiftParm) | (valueParm >> (64 - shiftParm));
+    }
+
+    static uint64_t pSplitMix(uint64_t& stateParm)
+    {
+        uint64_t sZ = (stateParm += 0x9e3779b97f4a7c15ULL);
+        sZ = (sZ ^ (sZ >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        sZ = (sZ ^ (sZ >> 27)) * 0x94d049bb133111ebULL;
+        return sZ ^ (sZ >> 31);
+    }
+
+    uint64_t mState[4];
+};
+
+#endif // RANDOM_ENGINE_H
@@ -0,0 +1,151 @@
+#ifndef ROARING_BITMAP_H
+#define ROARING_BITMAP_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @class RoaringBitmap
+ * @brief Compressed bitmap of 32-bit row numbers (roaring layout).
+ *
+ * Rows are split by their high 16 bits into containers. A container holds its
+ * low 16 bits either as a sorted array (sparse, up to ArrayMaxCardinality
+ * values) or as a 65536-bit bitset (dense), and switches representation as
+ * its cardinality crosses that threshold. AND/OR/AND-NOT work container by
+ * container, so rows outside the intersecting containers are never touched.
+ */
+class RoaringBitmap {
+public:
+    void add(uint32_t rowParm);
+    void remove(uint32_t rowParm);
+    bool contains(uint32_t rowParm) const;
+    size_t cardinality() const;
+    bool empty() const { return mContainers.empty(); }
+    void clear() { mContainers.clear(); }
+
+    static RoaringBitmap intersect(const RoaringBitmap& lhsParm, const RoaringBitmap& rhsParm);
+    static RoaringBitmap unite(const RoaringBitmap& lhsParm, const RoaringBitmap& rhsParm);
+    static RoaringBitmap subtract(const RoaringBitmap& lhsParm, const RoaringBitmap& rhsParm);
+
+    /**
+     * @brief Calls visitorParm(row) for every row in ascending order.
+     *        Stops early if the visitor returns false.
+     */
+    template <typename Visitor>
+    void forEach(Visitor visitorParm) const { forEachFrom(0, visitorParm); }
+
+    /**
+     * @brief Like forEach, but starts at the first row >= firstParm.
+     *        Containers before it are skipped by binary search.
+     */
+    template <typename Visitor>
+    void forEachFrom(uint32_t firstParm, Visitor visitorParm) const;
+
+    /**
+     * @brief Calls visitorParm(row) for every row <= lastParm in descending order.
+     *        Stops early if the visitor returns false.
+     */
+    template <typename Visitor>
+    void forEachDownFrom(uint32_t lastParm, Visitor visitorParm) const;
+
+private:
+    enum RoaringConstants {
+        ArrayMaxCardinality = 4096,
+        BitsetWords = 1024            // 65536 bits / 64
+    };
+
+    struct Container {
+        uint16_t mKey = 0;
+        uint32_t mCardinality = 0;
+        std::vector<uint16_t> mArray;   // used while sparse
+        std::vector<uint64_t> mBits;    // used once dense (non-empty <=> bitset)
+
+        bool isBitset() const { return !mBits.empty(); }
+        bool contains(uint16_t lowParm) const;
+        bool add(uint16_t lowParm);
+        bool remove(uint16_t lowParm);
+        void toBitset();
+        void toArray();
+    };
+
+    static Container pIntersect(const Container& lhsParm, const Container& rhsParm);
+    static Container pUnite(const Container& lhsParm, const Container& rhsParm);
+    static Container pSubtract(const Container& lhsParm, const Container& rhsParm);
+    static void pNormalize(Container& containerParm);
+
+    Container* pFind(uint16_t keyParm);
+    const Container* pFind(uint16_t keyParm) const;
+
+    std::vector<Container> mContainers;   // sorted by key
+};
+
+template <typename Visitor>
+void RoaringBitmap::forEachFrom(uint32_t firstParm, Visitor visitorParm) const
+{
+    const uint16_t sFirstKey = static_cast<uint16_t>(firstParm >> 16);
+    size_t sC = 0, sEnd = mContainers.size();
+    size_t sHi = sEnd;
+    while (sC < sHi) {
+        size_t sMid = (sC + sHi) / 2;
+        if (mContainers[sMid].mKey < sFirstKey) sC = sMid + 1; else sHi = sMid;
+    }
+    for (; sC < sEnd; ++sC) {
+        const Container& sContainer = mContainers[sC];
+        uint32_t sHigh = static_cast<uint32_t>(sContainer.mKey) << 16;
+        uint32_t sFirstLow = (sContainer.mKey == sFirstKey) ? (firstParm & 0xFFFF) : 0;
+        if (sContainer.isBitset()) {
+            for (size_t sW = sFirstLow / 64; sW < BitsetWords; ++sW) {
+                uint64_t sWord = sContainer.mBits[sW];
+                if (sW == sFirstLow / 64) sWord &= ~0ULL << (sFirstLow % 64);
+                while (sWord) {
+                    uint32_t sBit = static_cast<uint32_t>(__builtin_ctzll(sWord));
+                    if (!visitorParm(sHigh | static_cast<uint32_t>(sW * 64 + sBit))) return;
+                    sWord &= sWord - 1;
+                }
+            }
+        } else {
+            auto sIt = std::lower_bound(sContainer.mArray.begin(), sContainer.mArray.end(), sFirstLow);
+            for (; sIt != sContainer.mArray.end(); ++sIt) {
+                if (!visitorParm(sHigh | *sIt)) return;
+            }
+        }
+    }
+}
+
+template <typename Visitor>
+void RoaringBitmap::forEachDownFrom(uint32_t lastParm, Visitor visitorParm) const
+{
+    const uint16_t sLastKey = static_cast<uint16_t>(lastParm >> 16);
+    // First container with a key above sLastKey; walk down from the one before it.
+    size_t sLo = 0, sC = mContainers.size();
+    while (sLo < sC) {
+        size_t sMid = (sLo + sC) / 2;
+        if (mContainers[sMid].mKey <= sLastKey) sLo = sMid + 1; else sC = sMid;
+    }
+    while (sC-- > 0) {
+        const Container& sContainer = mContainers[sC];
+        uint32_t sHigh = static_cast<uint32_t>(sContainer.mKey) << 16;
+        uint32_t sLastLow = (sContainer.mKey == sLastKey) ? (lastParm & 0xFFFF) : 0xFFFF;
+        if (sContainer.isBitset()) {
+            for (size_t sW = sLastLow / 64 + 1; sW-- > 0;) {
+                uint64_t sWord = sContainer.mBits[sW];
+                if (sW == sLastLow / 64) sWord &= ~0ULL >> (63 - sLastLow % 64);
+                while (sWord) {
+                    uint32_t sBit = 63 - static_cast<uint32_t>(__builtin_clzll(sWord));
+                    if (!visitorParm(sHigh | static_cast<uint32_t>(sW * 64 + sBit))) return;
+                    sWord &= ~(1ULL << sBit);
+                }
+            }
+        } else {
+            auto sIt = std::upper_bound(sContainer.mArray.begin(), sContainer.mArray.end(), sLastLow);
+            while (sIt != sContainer.mArray.begin()) {
+                --sIt;
+                if (!visitorParm(sHigh | *sIt)) return;
+            }
+        }
+    }
+}
+
+#endif // ROARING_BITMAP_H
@@ -0,0 +1,60 @@
+#ifndef SHARDED_SHARED_MUTEX_H
+#define SHARDED_SHARED_MUTEX_H
+
+#include <atomic>
+#include <cstddef>
+#include <shared_mutex>
+
+enum LockShardConstants {
+    LockShards = 16,
+    LockShardBytes = 64     // one cache line per shard
+};
+
+/**
+ * @class ShardedSharedMutex
+ * @brief Reader/writer lock whose reader side is split into LockShards shards.
+ *
+ * A reader locks only the shard assigned to its thread, so readers on
+ * different cores do not all write the same lock word; a writer locks every
+ * shard, always in the same order. Meets the SharedMutex requirements used
+ * by std::shared_lock and std::unique_lock. Like std::shared_mutex, it must
+ * not be locked again by a thread that already holds it.
+ */
+class ShardedSharedMutex {
+public:
+    ShardedSharedMutex() = default;
+    ShardedSharedMutex(const ShardedSharedMutex&) = delete;
+    ShardedSharedMutex& operator=(const ShardedSharedMutex&) = delete;
+
+    void lock()
+    {
+        for (Shard& sShard : mShards) sShard.mMutex.lock();
+    }
+
+    void unlock()
+    {
+        for (size_t sI = LockShards; sI-- > 0;) mShards[sI].mMutex.unlock();
+    }
+
+    void lock_shared() { mShards[pShard()].mMutex.lock_shared(); }
+    void unlock_shared() { mShards[pShard()].mMutex.unlock_shared(); }
+
+private:
+    struct alignas(LockShardBytes) Shard {
+        std::shared_mutex mMutex;
+    };
+
+    /**
+     * @brief Shard of the calling thread: threads take shards round-robin on first use and keep them.
+     */
+    static size_t pShard()
+    {
+        static std::atomic<size_t> sNextShard(0);
+        thread_local size_t sShard = sNextShard.fetch_add(1, std::memory_order_relaxed) % LockShards;
+        return sShard;
+    }
+
+    Shard mShards[LockShards];
+};
+
+#endif // SHARDED_SHARED_MUTEX_H
@@ -0,0 +1,105 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class Symbol
+ * @brief 32-bit handle to a string held by the global SymbolTable.
+ *
+ * Equal strings always intern to the same handle, so comparing two symbols is
+ * an integer compare. A default-constructed Symbol is the empty string.
+ */
+class Symbol {
+public:
+    constexpr Symbol() : mHandle(0) {}
+
+    constexpr uint32_t handle() const { return mHandle; }
+    constexpr bool empty() const { return mHandle == 0; }
+
+    std::string_view view() const;
+    std::string str() const { return std::string(view()); }
+
+    constexpr bool operator==(const Symbol& otherParm) const { return mHandle == otherParm.mHandle; }
+    constexpr bool operator!=(const Symbol& otherParm) const { return mHandle != otherParm.mHandle; }
+
+private:
+    friend class SymbolTable;
+    explicit constexpr Symbol(uint32_t handleParm) : mHandle(handleParm) {}
+
+    uint32_t mHandle;
+};
+
+/**
+ * @class SymbolTable
+ * @brief Process-wide interned-string table (flyweight storage for names and labels).
+ *
+ * Each distinct string is stored once, in large character chunks that are never
+ * moved or freed, so the text behind a Symbol stays valid for the life of the
+ * program. Records then hold 4-byte symbols instead of owning std::strings.
+ *
+ * Safe to use from several threads. Entries live in fixed blocks that never
+ * move, so view() takes no lock; intern() and find() share mMutex, which
+ * intern() takes exclusively only to add a string.
+ */
+class SymbolTable {
+public:
+    /**
+     * @brief Returns the symbol for textParm, adding it on first use.
+     */
+    static Symbol intern(std::string_view textParm);
+
+    /**
+     * @brief Looks textParm up without adding it.
+     * @return false if no record could hold this string.
+     */
+    static bool find(std::string_view textParm, Symbol& symbolOutParm);
+
+    static std::string_view view(Symbol symbolParm) { return instance().pEntry(symbolParm.mHandle); }
+
+    /**
+     * @brief Symbol with the given handle, for walking the whole table; handleParm must be < size().
+     */
+    static Symbol at(uint32_t handleParm) { return Symbol(handleParm); }
+
+    /**
+     * @brief Number of distinct strings interned (including the empty string).
+     */
+    static size_t size() { return instance().mCount.load(std::memory_order_acquire); }
+
+private:
+    enum SymbolTableConstants {
+        ChunkBytes = 64 * 1024,
+        EntryBlockBits = 16,
+        EntryBlocks = 1 << 16     // EntryBlocks << EntryBlockBits handles in all
+    };
+
+    SymbolTable();
+    static SymbolTable& instance();
+    std::string_view pStore(std::string_view textParm);
+
+    std::string_view pEntry(uint32_t handleParm) const
+    {
+        return mEntryBlocks[handleParm >> EntryBlockBits][handleParm & ((1u << EntryBlockBits) - 1)];
+    }
+
+    std::unique_ptr<std::unique_ptr<std::string_view[]>[]> mEntryBlocks;   // handle -> text
+    std::atomic<uint32_t> mCount;
+    std::shared_mutex mMutex;                                // guards everything below
+    std::unordered_map<std::string_view, uint32_t> mLookup;  // text -> handle
+    std::vector<std::unique_ptr<char[]> > mChunks;
+    size_t mChunkUsed;
+};
+
+inline std::string_view Symbol::view() const { return SymbolTable::view(*this); }
+
+#endif // SYMBOL_TABLE_H
@@ -0,0 +1,70 @@
+#ifndef TABLE_RENDERER_H
+#define TABLE_RENDERER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class TableRenderer
+ * @brief Formats a boxed text table into one reusable buffer and writes it to stdout in bulk.
+ *
+ * The separator and heading lines are built once at construction. Rows are
+ * padded and copied straight into the buffer, and the first column is
+ * word-wrapped in place, so rendering a row allocates nothing. The buffer is
+ * handed to write(2) in one call whenever it fills and on flush(); std::cout
+ * is flushed first so output written through it stays in order.
+ */
+class TableRenderer {
+public:
+    /**
+     * @param widthsParm Width of each column.
+     * @param headingsParm Heading of each column.
+     * @param columnCountParm Number of columns; the first one word-wraps.
+     */
+    TableRenderer(const int* widthsParm, const char* const* headingsParm, int columnCountParm);
+    ~TableRenderer();
+
+    TableRenderer(const TableRenderer&) = delete;
+    TableRenderer& operator=(const TableRenderer&) = delete;
+
+    /**
+     * @brief Appends literal text (e.g. a caption) to the output.
+     */
+    void appendText(std::string_view textParm);
+
+    /**
+     * @brief Appends the separator, the heading line and another separator.
+     */
+    void appendHeader();
+
+    /**
+     * @brief Appends one row followed by a separator line.
+     * @param cellsParm One value per column; the first wraps onto extra lines,
+     *        the others appear on the first line only.
+     */
+    void appendRow(const std::string_view* cellsParm);
+
+    /**
+     * @brief Writes out everything buffered so far.
+     */
+    void flush();
+
+private:
+    enum TableRendererConstants { BufferBytes = 1 << 16 };
+
+    void pReserve(size_t bytesParm);
+    void pAppendCell(std::string_view valueParm, int widthParm);
+    size_t pNextWrappedLine(std::string_view& textParm, std::string_view& chunkParm,
+                            bool& doneParm, char* destParm) const;
+
+    std::vector<int> mWidths;
+    std::string mSeparator;
+    std::string mHeader;
+    size_t mLineBytes;
+    std::vector<char> mBuffer;
+    size_t mUsed;
+};
+
+#endif // TABLE_RENDERER_H
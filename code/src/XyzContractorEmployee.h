@@ -9,14 +9,18 @@ private:
     Agency mAgency;
 
 public:
-    XyzContractorEmployee(const std::string& nameParm, const std::string& idParm,
-                          const std::string& genderParm, const std::string& dobParm,
-                          const std::string& dojParm, EmployeeStatus statusParm,
-                          Agency agencyParm, const std::string& dolParm);
+    XyzContractorEmployee(Symbol nameParm, EmployeeId idParm,
+                          Symbol genderParm, CivilDate dobParm,
+                          CivilDate dojParm, EmployeeStatus statusParm,
+                          Agency agencyParm, CivilDate dolParm);
 
     Agency getAgency() const;
     EmployeeSummary toSummary() const override;
     void printFullDetails() const override;
+
+protected:
+    void visitDetailFields(EmployeeFieldVisitor& visitorParm) const override;
+    void detailArgs(NewEmployeeArgs& argsOutParm) const override;
 };
 
 #endif // XYZ_CONTRACTOR_EMPLOYEE_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define XYZ_EMPLOYEE_BASE_H
 
 #include "XyzEmployeeIF.h"
+#include "EmployeeFactory.h"
 #include "Enums.h"
 #include <string>
 
@@ -14,12 +15,12 @@
  */
 class XyzEmployeeBase : public XyzEmployeeIF {
 protected:
-    std::string mName;
-    std::string mId;
-    std::string mGender;
-    std::string mDob;
-    std::string mDoj;
-    std::string mDol;
+    Symbol mName;
+    EmployeeId mId;
+    Symbol mGender;
+    CivilDate mDob;
+    CivilDate mDoj;
+    CivilDate mDol;
     EmployeeStatus mStatus;
     EmployeeType mType;
 
@@ -27,10 +28,10 @@ public:
     /**
      * @brief Construct a new XyzEmployeeBase object.
      */
-    XyzEmployeeBase(const std::string& nameParm, const std::string& idParm,
-                    const std::string& genderParm, const std::string& dobParm,
-                    const std::string& dojParm, EmployeeStatus statusParm,
-                    EmployeeType typeParm, const std::string& dolParm = "NA")
+    XyzEmployeeBase(Symbol nameParm, EmployeeId idParm,
+                    Symbol genderParm, CivilDate dobParm,
+                    CivilDate dojParm, EmployeeStatus statusParm,
+                    EmployeeType typeParm, CivilDate dolParm = CivilDate())
         : mName(nameParm), mId(idParm), mGender(genderParm),
           mDob(dobParm), mDoj(dojParm), mDol(dolParm), mStatus(statusParm),
           mType(typeParm) {}
@@ -41,23 +42,63 @@ public:
     virtual ~XyzEmployeeBase() {}
 
     // Getters
-    std::string getName() const override { return mName; }
-    std::string getId() const override { return mId; }
-    std::string getGender() const override { return mGender; }
-    std::string getDob() const override { return mDob; }
-    std::string getDoj() const override { return mDoj; }
-    virtual std::string getDol() const { return mDol; }
+    std::string getName() const override { return mName.str(); }
+    std::string getId() const override { return mId.toString(); }
+    EmployeeId getEmployeeId() const override { return mId; }
+    std::string getGender() const override { return mGender.str(); }
+    Symbol getNameSymbol() const override { return mName; }
+    Symbol getGenderSymbol() const override { return mGender; }
+    std::string_view getNameView() const override { return mName.view(); }
+    std::string_view getGenderView() const override { return mGender.view(); }
+    std::string getDob() const override { return mDob.toString(); }
+    std::string getDoj() const override { return mDoj.toString(); }
+    virtual std::string getDol() const { return mDol.toString(); }
+    CivilDate getDobDate() const override { return mDob; }
+    CivilDate getDojDate() const override { return mDoj; }
+    CivilDate getDolDate() const { return mDol; }
     EmployeeStatus getStatus() const override { return mStatus; }
     EmployeeType getType() const override { return mType; }
 
-    void setStatus(EmployeeStatus statusParm) { mStatus = statusParm; }
-    void setDol(const std::string& dolParm) { mDol = dolParm; }
+    void setStatus(EmployeeStatus statusParm) override { mStatus = statusParm; }
+    void setDol(CivilDate dolParm) override { mDol = dolParm; }
 
     // Default no-op; overridden by full-time.
     void addLeaves(int) override {}
     virtual int getLeaves() const { return DefaultLeaves; }
 
     virtual void printFullDetails() const override = 0;
+
+    /**
+     * @brief Visits the common fields, then the subclass's own via visitDetailFields().
+     */
+    void visitFields(EmployeeFieldVisitor& visitorParm) const override
+    {
+        visitorParm.visitCommonFields(mName, mId, mGender, mType, mStatus, mDob, mDoj,
+                                      mStatus == Resigned ? mDol : CivilDate());
+        visitDetailFields(visitorParm);
+    }
+
+    /**
+     * @brief Copies the common fields, then the subclass's own via detailArgs().
+     */
+    void toArgs(NewEmployeeArgs& argsOutParm) const override
+    {
+        argsOutParm = NewEmployeeArgs();
+        argsOutParm.mName = mName;
+        argsOutParm.mId = mId;
+        argsOutParm.mGender = mGender;
+        argsOutParm.mDob = mDob;
+        argsOutParm.mDoj = mDoj;
+        argsOutParm.mDol = mDol;
+        argsOutParm.mType = mType;
+        argsOutParm.mStatus = mStatus;
+        detailArgs(argsOutParm);
+    }
+
+protected:
+    // Default: no type-specific fields.
+    virtual void visitDetailFields(EmployeeFieldVisitor&) const {}
+    virtual void detailArgs(NewEmployeeArgs&) const {}
 };
 
 #endif // XYZ_EMPLOYEE_BASE_H
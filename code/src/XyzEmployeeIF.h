@@ -2,9 +2,16 @@
 #define XYZ_EMPLOYEE_IF_H
 
 #include <string>
+#include <string_view>
 #include "EmployeeSummary.h"
+#include "EmployeeId.h"
+#include "CivilDate.h"
+#include "SymbolTable.h"
+#include "EmployeeFieldVisitor.h"
 #include "Enums.h"
 
+struct NewEmployeeArgs;
+
 /**
  * @class XyzEmployeeIF
  * @brief The interface class for all employee types.
@@ -16,16 +23,35 @@ class XyzEmployeeIF {
 public:
     virtual std::string getName() const = 0;
     virtual std::string getId() const = 0;
+    virtual EmployeeId getEmployeeId() const = 0;
     virtual std::string getGender() const = 0;
+    virtual Symbol getNameSymbol() const = 0;
+    virtual Symbol getGenderSymbol() const = 0;
+    virtual std::string_view getNameView() const = 0;
+    virtual std::string_view getGenderView() const = 0;
     virtual std::string getDob() const = 0;
     virtual std::string getDoj() const = 0;
+    virtual CivilDate getDobDate() const = 0;
+    virtual CivilDate getDojDate() const = 0;
 
     virtual EmployeeType getType() const = 0;
     virtual EmployeeStatus getStatus() const = 0;
+    virtual void setStatus(EmployeeStatus statusParm) = 0;
+    virtual void setDol(CivilDate dolParm) = 0;
 
     virtual EmployeeSummary toSummary() const = 0;
+
+    /**
+     * @brief Passes every displayable field to visitorParm without building strings.
+     */
+    virtual void visitFields(EmployeeFieldVisitor& visitorParm) const = 0;
     virtual void printFullDetails() const = 0;
 
+    /**
+     * @brief Copies every field into argsOutParm, so EmployeeFactory::create can rebuild the record.
+     */
+    virtual void toArgs(NewEmployeeArgs& argsOutParm) const = 0;
+
     virtual void addLeaves(int leavesParm) = 0;
 
     virtual ~XyzEmployeeIF() {}
@@ -2,12 +2,28 @@
 #define XYZ_EMPLOYEE_MANAGER_H
 
 #include "Deque.h"
+#include "EmployeeIdIndex.h"
+#include "EmployeeNameIndex.h"
+#include "EmployeeBitmapIndex.h"
+#include "EmployeeColumnStore.h"
+#include "EmployeeArena.h"
+#include "EmployeeRowSink.h"
+#include "EmployeeCursor.h"
+#include "EmployeeJournal.h"
+#include "EmployeeImport.h"
+#include "HelperFunctions.h"
+#include "ShardedSharedMutex.h"
 #include "XyzEmployeeIF.h"
 #include "Enums.h"
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <vector>
 #include <cstddef>
+#include <cstdint>
 
 class XyzEmployeeBase;
+class SnapshotFile;
 
 /**
  * @class XyzEmployeeManager
@@ -15,13 +31,41 @@ class XyzEmployeeBase;
  *
  * This class handles the user interface, employee creation, storage, modification,
  * and reporting. It uses two separate Deque instances to manage active/inactive
- * and resigned employees as required.
+ * and resigned employees as required, plus ID, name and attribute-bitmap
+ * indexes covering both. Bitmap indexes refer to records by row number;
+ * mRows maps a row back to the record. Records are either objects in mArena
+ * or handles onto mColumns, depending on the StorageEngine chosen at
+ * construction. Once openJournal() has been called, every mutation is also
+ * appended to mJournal.
+ *
+ * Every public operation may be called from several threads at once: reads
+ * hold mLock shared, writes hold it exclusively, and private helpers expect
+ * the caller to hold it. Reads lock one shard of mLock, so they run in
+ * parallel without contending on one lock word; a write still locks all
+ * shards, as every write updates the rosters, row table and indexes that
+ * span the whole roster. start() and the menus it shows are meant for one
+ * interactive session; they take the lock through the operations they call.
  */
 class XyzEmployeeManager {
 private:
     Deque<XyzEmployeeIF*> mActiveInactiveEmployees;
     Deque<XyzEmployeeIF*> mResignedEmployees;
-    int mEmployeeCounter;
+    EmployeeIdIndex mIdIndex;
+    EmployeeNameIndex mNameIndex;
+    EmployeeBitmapIndex mBitmapIndex;
+    std::vector<XyzEmployeeIF*> mRows;
+    StorageEngine mStorage;
+    EmployeeColumnStore mColumns;
+    EmployeeArena mArena;
+    uint64_t mEmployeeCounter;
+    std::vector<std::pair<uint64_t, uint64_t> > mReservedSequences;   // [first, last] blocks being drafted
+    RandomEngine mRandom;
+    EmployeeJournal mJournal;
+    uint64_t mGeneration;
+    mutable ShardedSharedMutex mLock;
+
+    typedef std::shared_lock<ShardedSharedMutex> ReadLock;
+    typedef std::unique_lock<ShardedSharedMutex> WriteLock;
 
     /**
      * Holds validated manual inputs when adding an employee.
@@ -29,8 +73,18 @@ private:
     struct ManualInputs {
         std::string mGender;
         std::string mName;
-        std::string mDob;
-        std::string mDoj;
+        CivilDate mDob;
+        CivilDate mDoj;
+    };
+
+    /**
+     * One bulk-generation batch: its ID block, seed and drafted employees.
+     */
+    struct RandomBatch {
+        uint64_t mFirstSequence = 0;
+        size_t mCount = 0;
+        RandomEngine::result_type mSeed = 0;
+        std::vector<NewEmployeeArgs> mArgs;
     };
 
     // --- Private Menu Functions ---
@@ -46,34 +100,107 @@ private:
     XyzEmployeeBase* pFindEmployeeAndIndex(const std::string& idParm,
                                            Deque<XyzEmployeeIF*>& dequeParm,
                                            size_t& indexOutParm);
+    Deque<XyzEmployeeIF*>::iterator pLocateInRoster(Deque<XyzEmployeeIF*>& dequeParm,
+                                                    const XyzEmployeeIF* employeeParm);
+    EmployeeLocation* pFindLocation(const std::string& idParm);
+    const EmployeeLocation* pFindLocation(const std::string& idParm) const;
+    XyzEmployeeIF* pCreateRecord(const NewEmployeeArgs& argsParm);
+    void pRegisterRecord(XyzEmployeeIF* employeeParm, const NewEmployeeArgs& argsParm);
+    void pIndexRecord(XyzEmployeeIF* employeeParm, const NewEmployeeArgs& argsParm);
+    void pInsertRecords(const NewEmployeeArgs* argsParm, size_t countParm);
+    size_t pAdmitImportedRows(ImportChunk& chunkParm, std::vector<NewEmployeeArgs>& argsOutParm);
+    void pArgsFromRow(const ImportRow& rowParm, EmployeeId idParm, NewEmployeeArgs& argsOutParm);
+    bool pSequenceInUse(uint64_t sequenceParm) const;
+    void pResign(EmployeeLocation& locationParm, CivilDate dolParm);
+    void pConvertToFullTime(EmployeeLocation& locationParm, const NewEmployeeArgs& argsParm);
+    size_t pAddLeaves(int leavesParm);
+    void pCommitJournal();
+    bool pReplayEntry(const JournalEntry& entryParm);
+    static bool pArgsValid(const NewEmployeeArgs& argsParm);
+    static bool pSnapshotValid(const SnapshotFile& fileParm);
+    static void pDraftRandomEmployee(RandomEngine& randomParm, EmployeeType typeParm,
+                                     uint64_t sequenceParm, NewEmployeeArgs& argsOutParm);
+    static void pDrawTypeDetails(RandomEngine& randomParm, NewEmployeeArgs& argsParm);
+    static void pBuildRandomBatches(std::vector<RandomBatch>& batchesParm, size_t firstParm, size_t strideParm);
+    XyzEmployeeIF* pReplaceRecord(XyzEmployeeIF* employeeParm, uint32_t rowParm, const NewEmployeeArgs& argsParm);
+    void pPrintNameMatches(const std::vector<EmployeeId>& idsParm, size_t limitParm,
+                           const std::string& notFoundMessageParm);
+    bool pStreamRoster(const Deque<XyzEmployeeIF*>& rosterParm, EmployeeRowSink& sinkParm) const;
+    void pPrintFilteredSummary(const EmployeeFilter& filterParm, const std::string& titleParm);
+    static std::string pFilterTitle(const EmployeeFilter& filterParm);
+    bool pRowMatches(uint32_t rowParm, const EmployeeFilter& filterParm, CursorPhase phaseParm) const;
+    const RoaringBitmap* pDrivingBitmap(const EmployeeFilter& filterParm, CursorPhase phaseParm, bool& emptyOutParm) const;
+    size_t pNextPage(EmployeeCursor& cursorParm, size_t pageSizeParm, EmployeeRowSink& sinkParm) const;
+    size_t pCountEmployees(const EmployeeFilter& filterParm) const;
+    template <typename Visitor>
+    bool pWalkPhase(const EmployeeFilter& filterParm, CursorPhase phaseParm, uint32_t rowParm,
+                    bool forwardParm, Visitor visitorParm) const;
+    void pBrowseReport(const EmployeeFilter& filterParm, const std::string& titleParm);
+    bool pReadFilterChoices(EmployeeFilter& filterOutParm);
     ManualInputs pReadManualInputs();
     std::string pReadGender() const;
     std::string pReadName() const;
-    std::string pReadDate(bool isDOB) const; 
+    CivilDate pReadDate(bool isDOB) const;
 
 public:
-    XyzEmployeeManager();
+    explicit XyzEmployeeManager(StorageEngine storageParm = ObjectStorage, uint64_t seedParm = 0);
     ~XyzEmployeeManager();
     void start();
 
     // --- Core Employee Management Operations ---
     void addEmployee(EmployeeType typeParm, bool isRandomParm);
     void addMultipleRandomEmployees(int countParm);
+    void insertEmployees(const NewEmployeeArgs* argsParm, size_t countParm);
+    bool importEmployees(const std::string& pathParm, RecordFormat formatParm, const std::string& rejectPathParm);
+    bool exportEmployees(const std::string& pathParm, RecordFormat formatParm, const EmployeeFilter& filterParm,
+                         const std::vector<ImportColumn>& columnsParm, ExportRosters rostersParm = ExportAllRosters) const;
     bool removeEmployee(const std::string& idParm);
     void convertInternToFullTime(const std::string& idParm);
     void convertContractorToFullTime(const std::string& idParm);
     void addLeavesToAllFullTime(int leavesParm);
     void searchById(const std::string& idParm);
     void searchByName(const std::string& nameParm);
+    void searchByNameIgnoreCase(const std::string& nameParm, size_t limitParm = DefaultNameSearchLimit);
+    void searchByNamePrefix(const std::string& prefixParm, size_t limitParm = DefaultNameSearchLimit);
     void markEmployeeResigned(const std::string& idParm);
     void moveEmployeeToResigned(const std::string &idParm, EmployeeType typeParm);
     
+    // --- Operations that report through their result instead of printing ---
+    OperationResult addEmployee(const ImportRow& rowParm, EmployeeId& idOutParm);
+    size_t addRandomEmployees(size_t countParm);
+    OperationResult resignEmployee(const std::string& idParm, CivilDate dolParm = CivilDate(),
+                                   std::string* nameOutParm = nullptr);
+    OperationResult convertToFullTime(const std::string& idParm, EmployeeType fromTypeParm,
+                                      std::string* nameOutParm = nullptr);
+    OperationResult addLeaves(int leavesParm, size_t& updatedOutParm);
+    bool findEmployee(const std::string& idParm, EmployeeRowSink& sinkParm) const;
+    size_t findEmployeesByName(const std::string& nameParm, bool prefixParm, size_t limitParm,
+                               EmployeeRowSink& sinkParm) const;
+    size_t countEmployees(const EmployeeFilter& filterParm) const;
+    size_t summarizeEmployees(const EmployeeFilter& filterParm, size_t pageSizeParm, EmployeeRowSink& sinkParm,
+                              size_t& matchesOutParm) const;
+
     // --- Reporting and Display Functions ---
     void printSummaryAll();
     void printSummaryByGender(const std::string& genderParm);
     void printSummaryByType(EmployeeType typeParm);
     void printSummaryByStatus(EmployeeStatus statusParm);
+    void printSummaryByFilter(const EmployeeFilter& filterParm);
     void printDetailsById(const std::string& idParm);
+
+    // --- Persistence ---
+    bool saveSnapshot(const std::string& pathParm);
+    bool loadSnapshot(const std::string& pathParm);
+    bool openJournal(const std::string& pathParm, unsigned syncIntervalParm);
+
+    // --- Paged Reports ---
+    EmployeeCursor openCursor(const EmployeeFilter& filterParm) const;
+    size_t nextPage(EmployeeCursor& cursorParm, size_t pageSizeParm, EmployeeRowSink& sinkParm) const;
+    size_t previousPage(EmployeeCursor& cursorParm, size_t pageSizeParm, EmployeeRowSink& sinkParm) const;
+    bool seekToId(EmployeeCursor& cursorParm, const std::string& idParm);
+
+    // --- Diagnostics ---
+    bool checkIndexes(std::string& errorOutParm) const;
 };
 
 #endif // XYZ_EMPLOYEE_MANAGER_H
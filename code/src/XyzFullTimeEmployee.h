@@ -9,15 +9,19 @@ private:
     int mLeavesAvail;
 
 public:
-    XyzFullTimeEmployee(const std::string& nameParm, const std::string& idParm,
-                        const std::string& genderParm, const std::string& dobParm,
-                        const std::string& dojParm, EmployeeStatus statusParm,
+    XyzFullTimeEmployee(Symbol nameParm, EmployeeId idParm,
+                        Symbol genderParm, CivilDate dobParm,
+                        CivilDate dojParm, EmployeeStatus statusParm,
                         int leavesAvailParm);
 
     void addLeaves(int leavesParm) override;
     int getLeaves() const override;
     EmployeeSummary toSummary() const override;
     void printFullDetails() const override;
+
+protected:
+    void visitDetailFields(EmployeeFieldVisitor& visitorParm) const override;
+    void detailArgs(NewEmployeeArgs& argsOutParm) const override;
 };
 
 #endif // XYZ_FULL_TIME_EMPLOYEE_H
\ No newline at end of file
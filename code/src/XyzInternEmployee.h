@@ -10,15 +10,19 @@ private:
     Branch mBranch;
 
 public:
-    XyzInternEmployee(const std::string& nameParm, const std::string& idParm,
-                      const std::string& genderParm, const std::string& dobParm,
-                      const std::string& dojParm, EmployeeStatus statusParm,
-                      College collegeParm, Branch branchParm, const std::string& dolParm);
+    XyzInternEmployee(Symbol nameParm, EmployeeId idParm,
+                      Symbol genderParm, CivilDate dobParm,
+                      CivilDate dojParm, EmployeeStatus statusParm,
+                      College collegeParm, Branch branchParm, CivilDate dolParm);
 
     College getCollege() const;
     Branch getBranch() const;
     EmployeeSummary toSummary() const override;
     void printFullDetails() const override;
+
+protected:
+    void visitDetailFields(EmployeeFieldVisitor& visitorParm) const override;
+    void detailArgs(NewEmployeeArgs& argsOutParm) const override;
 };
 
 #endif // XYZ_INTERN_EMPLOYEE_H
\ No newline at end of file
@@ -6,10 +6,10 @@
 
 class XyzResignedEmployee : public XyzEmployeeBase {
 public:
-    XyzResignedEmployee(const std::string& nameParm, const std::string& idParm,
-                        EmployeeType typeParm, const std::string& genderParm,
-                        const std::string& dobParm, const std::string& dojParm,
-                        const std::string& dolParm);
+    XyzResignedEmployee(Symbol nameParm, EmployeeId idParm,
+                        EmployeeType typeParm, Symbol genderParm,
+                        CivilDate dobParm, CivilDate dojParm,
+                        CivilDate dolParm);
 
     EmployeeSummary toSummary() const override;
     void printFullDetails() const override;